@@ -49,7 +49,7 @@ if (BUILD_BENCHMARKS)
     endif()
 endif()
 
-if (BUILD_BENCHMARKS OR BUILD_EXAMPLES)
+if (BUILD_BENCHMARKS OR BUILD_EXAMPLES OR BUILD_UNIT_TESTS)
     find_package(Threads REQUIRED)
 endif()
 
@@ -65,6 +65,23 @@ nonius::benchmark bench_rttr_invoke_method_void_return_value()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_typed_invoke_method_void_return_value()
+{
+    return nonius::benchmark("rttr typed", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+        rttr::method m = rttr::type::get(obj).get_method("method_0");
+        auto func = m.get_invoker<void(ns_foo::method_class&)>();
+
+        meter.measure([&]()
+        {
+            return func(obj);
+        });
+    });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -98,6 +115,23 @@ nonius::benchmark bench_rttr_invoke_method_int_return_value()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_typed_invoke_method_int_return_value()
+{
+    return nonius::benchmark("rttr typed", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+        rttr::method m = rttr::type::get(obj).get_method("int_method");
+        auto func = m.get_invoker<int(ns_foo::method_class&)>();
+
+        meter.measure([&]()
+        {
+            return func(obj);
+        });
+    });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -131,6 +165,23 @@ nonius::benchmark bench_rttr_invoke_method_string_return_value()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_typed_invoke_method_string_return_value()
+{
+    return nonius::benchmark("rttr typed", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+        rttr::method m = rttr::type::get(obj).get_method("string_method");
+        auto func = m.get_invoker<std::string(ns_foo::method_class&)>();
+
+        meter.measure([&]()
+        {
+            return func(obj);
+        });
+    });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -164,6 +215,23 @@ nonius::benchmark bench_rttr_invoke_method_arg_1()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_typed_invoke_method_arg_1()
+{
+    return nonius::benchmark("rttr typed", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+        rttr::method m = rttr::type::get(obj).get_method("void_method_arg_1");
+        auto func = m.get_invoker<void(ns_foo::method_class&, int)>();
+
+        meter.measure([&]()
+        {
+            return func(obj, 23);
+        });
+    });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -197,6 +265,23 @@ nonius::benchmark bench_rttr_invoke_method_arg_2()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_typed_invoke_method_arg_2()
+{
+    return nonius::benchmark("rttr typed", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+        rttr::method m = rttr::type::get(obj).get_method("void_method_arg_2");
+        auto func = m.get_invoker<void(ns_foo::method_class&, int, int)>();
+
+        meter.measure([&]()
+        {
+            return func(obj, 23, 42);
+        });
+    });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -230,6 +315,23 @@ nonius::benchmark bench_rttr_invoke_method_arg_3()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_typed_invoke_method_arg_3()
+{
+    return nonius::benchmark("rttr typed", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+        rttr::method m = rttr::type::get(obj).get_method("void_method_arg_3");
+        auto func = m.get_invoker<void(ns_foo::method_class&, int, int, int)>();
+
+        meter.measure([&]()
+        {
+            return func(obj, 23, 42, 5);
+        });
+    });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -263,6 +365,23 @@ nonius::benchmark bench_rttr_invoke_method_arg_8()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_typed_invoke_method_arg_8()
+{
+    return nonius::benchmark("rttr typed", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+        rttr::method m = rttr::type::get(obj).get_method("void_method_arg_8");
+        auto func = m.get_invoker<void(ns_foo::method_class&, int, int, int, int, int, int, int, int)>();
+
+        meter.measure([&]()
+        {
+            return func(obj, 1, 2, 3, 4, 5, 6, 7, 8);
+        });
+    });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -296,6 +415,24 @@ nonius::benchmark bench_rttr_invoke_method_ptr_arg()
     });
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_typed_invoke_method_ptr_arg()
+{
+    return nonius::benchmark("rttr typed", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+        rttr::method m = rttr::type::get(obj).get_method("method_ptr_arg");
+        auto func = m.get_invoker<void(ns_foo::method_class&, int*)>();
+        int* ptr = nullptr;
+
+        meter.measure([&]()
+        {
+            return func(obj, ptr);
+        });
+    });
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -328,9 +465,14 @@ void bench_invoke_method()
                                             "\n"
                                             "// rttr approach\n"
                                             "m.invoke(obj);\n"
+                                            "\n"
+                                            "// rttr typed approach\n"
+                                            "auto func = m.get_invoker<void(Foo&)>();\n"
+                                            "func(obj);\n"
                                             "</pre>");
     nonius::benchmark benchmarks_group_1[] = { bench_native_invoke_method_void_return_value(),
-                                               bench_rttr_invoke_method_void_return_value()};
+                                               bench_rttr_invoke_method_void_return_value(),
+                                               bench_rttr_typed_invoke_method_void_return_value()};
     // for unknown reason we have the run a pre-benchmark, otherwise we get wrong result (all samples are at: 0ns)
     auto dummy_benchmark = nonius::benchmark_registry{bench_rttr_invoke_method_void_return_value()};
     nonius::go(cfg, dummy_benchmark);
@@ -357,9 +499,14 @@ void bench_invoke_method()
                                             "\n"
                                             "// rttr approach\n"
                                             "m.invoke(obj);\n"
+                                            "\n"
+                                            "// rttr typed approach\n"
+                                            "auto func = m.get_invoker<int(Foo&)>();\n"
+                                            "func(obj);\n"
                                             "</pre>");
     nonius::benchmark benchmarks_group_2[] = { bench_native_invoke_method_int_return_value(),
-                                               bench_rttr_invoke_method_int_return_value()};
+                                               bench_rttr_invoke_method_int_return_value(),
+                                               bench_rttr_typed_invoke_method_int_return_value()};
 
     nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
 
@@ -384,9 +531,14 @@ void bench_invoke_method()
                                                    "\n"
                                                    "// rttr approach\n"
                                                    "m.invoke(obj);\n"
+                                                   "\n"
+                                                   "// rttr typed approach\n"
+                                                   "auto func = m.get_invoker<std::string(Foo&)>();\n"
+                                                   "func(obj);\n"
                                                    "</pre>");
     nonius::benchmark benchmarks_group_3[] = { bench_native_invoke_method_string_return_value(),
-                                               bench_rttr_invoke_method_string_return_value()};
+                                               bench_rttr_invoke_method_string_return_value(),
+                                               bench_rttr_typed_invoke_method_string_return_value()};
 
     nonius::go(cfg, std::begin(benchmarks_group_3), std::end(benchmarks_group_3), reporter);
 
@@ -412,9 +564,14 @@ void bench_invoke_method()
                                               "\n"
                                               "// rttr approach\n"
                                               "m.invoke(obj, 42);\n"
+                                              "\n"
+                                              "// rttr typed approach\n"
+                                              "auto func = m.get_invoker<void(Foo&, int)>();\n"
+                                              "func(obj, 42);\n"
                                               "</pre>");
     nonius::benchmark benchmarks_group_4[] = { bench_native_invoke_method_arg_1(),
-                                               bench_rttr_invoke_method_arg_1()};
+                                               bench_rttr_invoke_method_arg_1(),
+                                               bench_rttr_typed_invoke_method_arg_1()};
 
     nonius::go(cfg, std::begin(benchmarks_group_4), std::end(benchmarks_group_4), reporter);
 
@@ -440,9 +597,14 @@ void bench_invoke_method()
                                               "\n"
                                               "// rttr approach\n"
                                               "m.invoke(obj, 42, 23);\n"
+                                              "\n"
+                                              "// rttr typed approach\n"
+                                              "auto func = m.get_invoker<void(Foo&, int, int)>();\n"
+                                              "func(obj, 42, 23);\n"
                                               "</pre>");
     nonius::benchmark benchmarks_group_5[] = { bench_native_invoke_method_arg_2(),
-                                               bench_rttr_invoke_method_arg_2()};
+                                               bench_rttr_invoke_method_arg_2(),
+                                               bench_rttr_typed_invoke_method_arg_2()};
 
     nonius::go(cfg, std::begin(benchmarks_group_5), std::end(benchmarks_group_5), reporter);
 
@@ -468,9 +630,14 @@ void bench_invoke_method()
                                               "\n"
                                               "// rttr approach\n"
                                               "m.invoke(obj, 42, 23, 5);\n"
+                                              "\n"
+                                              "// rttr typed approach\n"
+                                              "auto func = m.get_invoker<void(Foo&, int, int, int)>();\n"
+                                              "func(obj, 42, 23, 5);\n"
                                               "</pre>");
     nonius::benchmark benchmarks_group_6[] = { bench_native_invoke_method_arg_3(),
-                                               bench_rttr_invoke_method_arg_3()};
+                                               bench_rttr_invoke_method_arg_3(),
+                                               bench_rttr_typed_invoke_method_arg_3()};
 
     nonius::go(cfg, std::begin(benchmarks_group_6), std::end(benchmarks_group_6), reporter);
 
@@ -501,9 +668,14 @@ void bench_invoke_method()
                                               "\n"
                                               "// rttr approach\n"
                                               "m.invoke_variadic(obj, args);\n"
+                                              "\n"
+                                              "// rttr typed approach\n"
+                                              "auto func = m.get_invoker<void(Foo&, int, ..., int)>();\n"
+                                              "func(obj, 1, 2, 3, 4, 5, 6, 7, 8);\n"
                                               "</pre>");
     nonius::benchmark benchmarks_group_7[] = { bench_native_invoke_method_arg_8(),
-                                               bench_rttr_invoke_method_arg_8()};
+                                               bench_rttr_invoke_method_arg_8(),
+                                               bench_rttr_typed_invoke_method_arg_8()};
 
     nonius::go(cfg, std::begin(benchmarks_group_7), std::end(benchmarks_group_7), reporter);
 
@@ -528,9 +700,14 @@ void bench_invoke_method()
                                                 "\n"
                                                 "// rttr approach\n"
                                                 "m.invoke(obj, nullptr);\n"
+                                                "\n"
+                                                "// rttr typed approach\n"
+                                                "auto func = m.get_invoker<void(Foo&, int*)>();\n"
+                                                "func(obj, nullptr);\n"
                                                 "</pre>");
     nonius::benchmark benchmarks_group_8[] = { bench_native_invoke_method_ptr_arg(),
-                                               bench_rttr_invoke_method_ptr_arg()};
+                                               bench_rttr_invoke_method_ptr_arg(),
+                                               bench_rttr_typed_invoke_method_ptr_arg()};
 
     nonius::go(cfg, dummy_benchmark);
     nonius::go(cfg, std::begin(benchmarks_group_8), std::end(benchmarks_group_8), reporter);
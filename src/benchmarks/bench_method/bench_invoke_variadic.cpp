@@ -0,0 +1,213 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "benchmarks/bench_method/test_methods.h"
+
+#include <rttr/type>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_invoke_variadic_arg_3()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+
+        meter.measure([&]()
+        {
+            return obj.void_method_arg_3(1, 2, 3);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_invoke_variadic_vector_arg_3()
+{
+    return nonius::benchmark("rttr vector", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+        rttr::method m = rttr::type::get(obj).get_method("void_method_arg_3");
+        int v1 = 1, v2 = 2, v3 = 3;
+
+        meter.measure([&]()
+        {
+            return m.invoke_variadic(obj, {v1, v2, v3});
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_invoke_variadic_array_arg_3()
+{
+    return nonius::benchmark("rttr array", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+        rttr::method m = rttr::type::get(obj).get_method("void_method_arg_3");
+        int v1 = 1, v2 = 2, v3 = 3;
+
+        meter.measure([&]()
+        {
+            rttr::argument args[] = {v1, v2, v3};
+            return m.invoke_variadic(obj, args, 3);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_invoke_variadic_arg_8()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+
+        meter.measure([&]()
+        {
+            return obj.void_method_arg_8(1, 2, 3, 4, 5, 6, 7, 8);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_invoke_variadic_vector_arg_8()
+{
+    return nonius::benchmark("rttr vector", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+        rttr::method m = rttr::type::get(obj).get_method("void_method_arg_8");
+        int v1 = 1, v2 = 2, v3 = 3, v4 = 4, v5 = 5, v6 = 6, v7 = 7, v8 = 8;
+
+        meter.measure([&]()
+        {
+            return m.invoke_variadic(obj, {v1, v2, v3, v4, v5, v6, v7, v8});
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_invoke_variadic_array_arg_8()
+{
+    return nonius::benchmark("rttr array", [](nonius::chronometer meter)
+    {
+        ns_foo::method_class obj;
+        rttr::method m = rttr::type::get(obj).get_method("void_method_arg_8");
+        int v1 = 1, v2 = 2, v3 = 3, v4 = 4, v5 = 5, v6 = 6, v7 = 7, v8 = 8;
+
+        meter.measure([&]()
+        {
+            rttr::argument args[] = {v1, v2, v3, v4, v5, v6, v7, v8};
+            return m.invoke_variadic(obj, args, 8);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_invoke_variadic()
+{
+    nonius::configuration cfg;
+    cfg.title = "invoke_variadic member method";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_invoke_variadic.html");
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("arg 3", "benchmark code:"
+                                             "<pre>"
+                                             "// Foo.h\n"
+                                             "struct Foo {\n"
+                                             "    void method(int, int, int);\n"
+                                             "};\n"
+                                             "\n"
+                                             "// Setup\n"
+                                             "Foo obj;\n"
+                                             "rttr::method m = rttr::type::get(obj).get_method(\"method\");\n"
+                                             "// Benchmarking:\n\n"
+                                             "// native approach\n"
+                                             "obj.method(1, 2, 3);\n"
+                                             "\n"
+                                             "// rttr vector approach\n"
+                                             "m.invoke_variadic(obj, {1, 2, 3});\n"
+                                             "\n"
+                                             "// rttr array approach\n"
+                                             "rttr::argument args[] = {1, 2, 3};\n"
+                                             "m.invoke_variadic(obj, args, 3);\n"
+                                             "</pre>");
+    nonius::benchmark benchmarks_group_1[] = { bench_native_invoke_variadic_arg_3(),
+                                               bench_rttr_invoke_variadic_vector_arg_3(),
+                                               bench_rttr_invoke_variadic_array_arg_3()};
+    // for unknown reason we have the run a pre-benchmark, otherwise we get wrong result (all samples are at: 0ns)
+    auto dummy_benchmark = nonius::benchmark_registry{bench_rttr_invoke_variadic_array_arg_3()};
+    nonius::go(cfg, dummy_benchmark);
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("arg 8", "benchmark code:"
+                                             "<pre>"
+                                             "// Foo.h\n"
+                                             "struct Foo {\n"
+                                             "    void method(int, int, int, int, int, int, int, int);\n"
+                                             "};\n"
+                                             "\n"
+                                             "// Setup\n"
+                                             "Foo obj;\n"
+                                             "rttr::method m = rttr::type::get(obj).get_method(\"method\");\n"
+                                             "// Benchmarking:\n\n"
+                                             "// native approach\n"
+                                             "obj.method(1, 2, 3, 4, 5, 6, 7, 8);\n"
+                                             "\n"
+                                             "// rttr vector approach\n"
+                                             "m.invoke_variadic(obj, {1, 2, 3, 4, 5, 6, 7, 8});\n"
+                                             "\n"
+                                             "// rttr array approach\n"
+                                             "rttr::argument args[] = {1, 2, 3, 4, 5, 6, 7, 8};\n"
+                                             "m.invoke_variadic(obj, args, 8);\n"
+                                             "</pre>");
+    nonius::benchmark benchmarks_group_2[] = { bench_native_invoke_variadic_arg_8(),
+                                               bench_rttr_invoke_variadic_vector_arg_8(),
+                                               bench_rttr_invoke_variadic_array_arg_8()};
+    nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
+
+    /////////////////////////////////////
+
+    reporter.generate_report();
+}
@@ -33,4 +33,5 @@ set(SOURCE_FILES main.cpp
                  bench_method.cpp
                  bench_find_method.cpp
                  bench_invoke_method.cpp
+                 bench_invoke_variadic.cpp
                  test_methods.cpp)
@@ -27,12 +27,14 @@
 
 extern void bench_method();
 extern void bench_invoke_method();
+extern void bench_invoke_variadic();
 /////////////////////////////////////////////////////////////////////////////////////////
 
 int main(int /* argc */, char** /* argv */)
 {
     bench_method();
     bench_invoke_method();
+    bench_invoke_variadic();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,552 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "benchmarks/bench_property/test_properties.h"
+
+#include <rttr/type>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_property_int_get()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        ns_foo::property_class obj;
+
+        meter.measure([&]()
+        {
+            return obj.int_value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_property_int_get()
+{
+    return nonius::benchmark("rttr", [](nonius::chronometer meter)
+    {
+        ns_foo::property_class obj;
+        rttr::property prop = rttr::type::get(obj).get_property("int_value");
+
+        meter.measure([&]()
+        {
+            return prop.get_value(obj);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_typed_property_int_get()
+{
+    return nonius::benchmark("rttr typed", [](nonius::chronometer meter)
+    {
+        ns_foo::property_class obj;
+        rttr::property prop = rttr::type::get(obj).get_property("int_value");
+        auto acc = prop.get_accessor<ns_foo::property_class, int>();
+
+        meter.measure([&]()
+        {
+            return acc.get(obj);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_property_int_set()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        ns_foo::property_class obj;
+
+        meter.measure([&]()
+        {
+            obj.int_value = 42;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_property_int_set()
+{
+    return nonius::benchmark("rttr", [](nonius::chronometer meter)
+    {
+        ns_foo::property_class obj;
+        rttr::property prop = rttr::type::get(obj).get_property("int_value");
+
+        meter.measure([&]()
+        {
+            return prop.set_value(obj, 42);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_typed_property_int_set()
+{
+    return nonius::benchmark("rttr typed", [](nonius::chronometer meter)
+    {
+        ns_foo::property_class obj;
+        rttr::property prop = rttr::type::get(obj).get_property("int_value");
+        auto acc = prop.get_accessor<ns_foo::property_class, int>();
+
+        meter.measure([&]()
+        {
+            acc.set(obj, 42);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_property_string_get()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        ns_foo::property_class obj;
+
+        meter.measure([&]()
+        {
+            return obj.string_value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_property_string_get()
+{
+    return nonius::benchmark("rttr", [](nonius::chronometer meter)
+    {
+        ns_foo::property_class obj;
+        rttr::property prop = rttr::type::get(obj).get_property("string_value");
+
+        meter.measure([&]()
+        {
+            return prop.get_value(obj);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_typed_property_string_get()
+{
+    return nonius::benchmark("rttr typed", [](nonius::chronometer meter)
+    {
+        ns_foo::property_class obj;
+        rttr::property prop = rttr::type::get(obj).get_property("string_value");
+        auto acc = prop.get_accessor<ns_foo::property_class, std::string>();
+
+        meter.measure([&]()
+        {
+            return acc.get(obj);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_typed_ref_property_string_get()
+{
+    return nonius::benchmark("rttr typed const&", [](nonius::chronometer meter)
+    {
+        ns_foo::property_class obj;
+        rttr::property prop = rttr::type::get(obj).get_property("string_value");
+        auto acc = prop.get_accessor<ns_foo::property_class, const std::string&>();
+
+        meter.measure([&]()
+        {
+            // no copy of the string is made
+            return acc.get(obj).data();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_property_string_set()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        ns_foo::property_class obj;
+        const std::string value = "Hello World";
+
+        meter.measure([&]()
+        {
+            obj.string_value = value;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_property_string_set()
+{
+    return nonius::benchmark("rttr", [](nonius::chronometer meter)
+    {
+        ns_foo::property_class obj;
+        const std::string value = "Hello World";
+        rttr::property prop = rttr::type::get(obj).get_property("string_value");
+
+        meter.measure([&]()
+        {
+            return prop.set_value(obj, value);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_typed_property_string_set()
+{
+    return nonius::benchmark("rttr typed", [](nonius::chronometer meter)
+    {
+        ns_foo::property_class obj;
+        const std::string value = "Hello World";
+        rttr::property prop = rttr::type::get(obj).get_property("string_value");
+        auto acc = prop.get_accessor<ns_foo::property_class, std::string>();
+
+        meter.measure([&]()
+        {
+            acc.set(obj, value);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_property_int_func_get()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        ns_foo::property_class obj;
+
+        meter.measure([&]()
+        {
+            return obj.get_int_value();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_property_int_func_get()
+{
+    return nonius::benchmark("rttr", [](nonius::chronometer meter)
+    {
+        ns_foo::property_class obj;
+        rttr::property prop = rttr::type::get(obj).get_property("int_func");
+
+        meter.measure([&]()
+        {
+            return prop.get_value(obj);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_typed_property_int_func_get()
+{
+    return nonius::benchmark("rttr typed", [](nonius::chronometer meter)
+    {
+        ns_foo::property_class obj;
+        rttr::property prop = rttr::type::get(obj).get_property("int_func");
+        auto acc = prop.get_accessor<ns_foo::property_class, int>();
+
+        meter.measure([&]()
+        {
+            return acc.get(obj);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_property_int_func_set()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        ns_foo::property_class obj;
+
+        meter.measure([&]()
+        {
+            obj.set_int_value(42);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_property_int_func_set()
+{
+    return nonius::benchmark("rttr", [](nonius::chronometer meter)
+    {
+        ns_foo::property_class obj;
+        rttr::property prop = rttr::type::get(obj).get_property("int_func");
+
+        meter.measure([&]()
+        {
+            return prop.set_value(obj, 42);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_typed_property_int_func_set()
+{
+    return nonius::benchmark("rttr typed", [](nonius::chronometer meter)
+    {
+        ns_foo::property_class obj;
+        rttr::property prop = rttr::type::get(obj).get_property("int_func");
+        auto acc = prop.get_accessor<ns_foo::property_class, int>();
+
+        meter.measure([&]()
+        {
+            acc.set(obj, 42);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_property_access()
+{
+    nonius::configuration cfg;
+    cfg.title = "property access";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_property_access.html");
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("get int", "benchmark code:"
+                                               "<pre>"
+                                               "// Foo.h\n"
+                                               "struct Foo {\n"
+                                               "    int value;\n"
+                                               "};\n"
+                                               "\n"
+                                               "// Setup\n"
+                                               "Foo obj;\n"
+                                               "rttr::property prop = rttr::type::get(obj).get_property(\"value\");\n"
+                                               "auto acc = prop.get_accessor<Foo, int>();\n"
+                                               "// Benchmarking:\n\n"
+                                               "// native approach\n"
+                                               "obj.value;\n"
+                                               "\n"
+                                               "// rttr approach\n"
+                                               "prop.get_value(obj);\n"
+                                               "\n"
+                                               "// rttr typed approach\n"
+                                               "acc.get(obj);\n"
+                                               "</pre>");
+    nonius::benchmark benchmarks_group_1[] = { bench_native_property_int_get(),
+                                               bench_rttr_property_int_get(),
+                                               bench_rttr_typed_property_int_get()};
+    // for unknown reason we have the run a pre-benchmark, otherwise we get wrong result (all samples are at: 0ns)
+    auto dummy_benchmark = nonius::benchmark_registry{bench_rttr_property_int_get()};
+    nonius::go(cfg, dummy_benchmark);
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("set int", "benchmark code:"
+                                               "<pre>"
+                                               "// Foo.h\n"
+                                               "struct Foo {\n"
+                                               "    int value;\n"
+                                               "};\n"
+                                               "\n"
+                                               "// Setup\n"
+                                               "Foo obj;\n"
+                                               "rttr::property prop = rttr::type::get(obj).get_property(\"value\");\n"
+                                               "auto acc = prop.get_accessor<Foo, int>();\n"
+                                               "// Benchmarking:\n\n"
+                                               "// native approach\n"
+                                               "obj.value = 42;\n"
+                                               "\n"
+                                               "// rttr approach\n"
+                                               "prop.set_value(obj, 42);\n"
+                                               "\n"
+                                               "// rttr typed approach\n"
+                                               "acc.set(obj, 42);\n"
+                                               "</pre>");
+    nonius::benchmark benchmarks_group_2[] = { bench_native_property_int_set(),
+                                               bench_rttr_property_int_set(),
+                                               bench_rttr_typed_property_int_set()};
+    nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("get std::string", "benchmark code:"
+                                                       "<pre>"
+                                                       "// Foo.h\n"
+                                                       "struct Foo {\n"
+                                                       "    std::string value;\n"
+                                                       "};\n"
+                                                       "\n"
+                                                       "// Setup\n"
+                                                       "Foo obj;\n"
+                                                       "rttr::property prop = rttr::type::get(obj).get_property(\"value\");\n"
+                                                       "auto acc = prop.get_accessor<Foo, std::string>();\n"
+                                                       "auto ref_acc = prop.get_accessor<Foo, const std::string&>();\n"
+                                                       "// Benchmarking:\n\n"
+                                                       "// native approach\n"
+                                                       "obj.value;\n"
+                                                       "\n"
+                                                       "// rttr approach\n"
+                                                       "prop.get_value(obj);\n"
+                                                       "\n"
+                                                       "// rttr typed approach\n"
+                                                       "acc.get(obj);\n"
+                                                       "\n"
+                                                       "// rttr typed const& approach, without copy\n"
+                                                       "ref_acc.get(obj).data();\n"
+                                                       "</pre>");
+    nonius::benchmark benchmarks_group_3[] = { bench_native_property_string_get(),
+                                               bench_rttr_property_string_get(),
+                                               bench_rttr_typed_property_string_get(),
+                                               bench_rttr_typed_ref_property_string_get()};
+    nonius::go(cfg, std::begin(benchmarks_group_3), std::end(benchmarks_group_3), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("set std::string", "benchmark code:"
+                                                       "<pre>"
+                                                       "// Foo.h\n"
+                                                       "struct Foo {\n"
+                                                       "    std::string value;\n"
+                                                       "};\n"
+                                                       "\n"
+                                                       "// Setup\n"
+                                                       "Foo obj;\n"
+                                                       "const std::string str = \"Hello World\";\n"
+                                                       "rttr::property prop = rttr::type::get(obj).get_property(\"value\");\n"
+                                                       "auto acc = prop.get_accessor<Foo, std::string>();\n"
+                                                       "// Benchmarking:\n\n"
+                                                       "// native approach\n"
+                                                       "obj.value = str;\n"
+                                                       "\n"
+                                                       "// rttr approach\n"
+                                                       "prop.set_value(obj, str);\n"
+                                                       "\n"
+                                                       "// rttr typed approach\n"
+                                                       "acc.set(obj, str);\n"
+                                                       "</pre>");
+    nonius::benchmark benchmarks_group_4[] = { bench_native_property_string_set(),
+                                               bench_rttr_property_string_set(),
+                                               bench_rttr_typed_property_string_set()};
+    nonius::go(cfg, std::begin(benchmarks_group_4), std::end(benchmarks_group_4), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("get int (getter)", "benchmark code:"
+                                                        "<pre>"
+                                                        "// Foo.h\n"
+                                                        "struct Foo {\n"
+                                                        "    int get_value() const;\n"
+                                                        "    void set_value(int);\n"
+                                                        "};\n"
+                                                        "\n"
+                                                        "// Setup\n"
+                                                        "Foo obj;\n"
+                                                        "rttr::property prop = rttr::type::get(obj).get_property(\"value\");\n"
+                                                        "auto acc = prop.get_accessor<Foo, int>();\n"
+                                                        "// Benchmarking:\n\n"
+                                                        "// native approach\n"
+                                                        "obj.get_value();\n"
+                                                        "\n"
+                                                        "// rttr approach\n"
+                                                        "prop.get_value(obj);\n"
+                                                        "\n"
+                                                        "// rttr typed approach\n"
+                                                        "acc.get(obj);\n"
+                                                        "</pre>");
+    nonius::benchmark benchmarks_group_5[] = { bench_native_property_int_func_get(),
+                                               bench_rttr_property_int_func_get(),
+                                               bench_rttr_typed_property_int_func_get()};
+    nonius::go(cfg, std::begin(benchmarks_group_5), std::end(benchmarks_group_5), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("set int (setter)", "benchmark code:"
+                                                        "<pre>"
+                                                        "// Foo.h\n"
+                                                        "struct Foo {\n"
+                                                        "    int get_value() const;\n"
+                                                        "    void set_value(int);\n"
+                                                        "};\n"
+                                                        "\n"
+                                                        "// Setup\n"
+                                                        "Foo obj;\n"
+                                                        "rttr::property prop = rttr::type::get(obj).get_property(\"value\");\n"
+                                                        "auto acc = prop.get_accessor<Foo, int>();\n"
+                                                        "// Benchmarking:\n\n"
+                                                        "// native approach\n"
+                                                        "obj.set_value(42);\n"
+                                                        "\n"
+                                                        "// rttr approach\n"
+                                                        "prop.set_value(obj, 42);\n"
+                                                        "\n"
+                                                        "// rttr typed approach\n"
+                                                        "acc.set(obj, 42);\n"
+                                                        "</pre>");
+    nonius::benchmark benchmarks_group_6[] = { bench_native_property_int_func_set(),
+                                               bench_rttr_property_int_func_set(),
+                                               bench_rttr_typed_property_int_func_set()};
+    nonius::go(cfg, std::begin(benchmarks_group_6), std::end(benchmarks_group_6), reporter);
+
+    /////////////////////////////////////
+
+    reporter.generate_report();
+}
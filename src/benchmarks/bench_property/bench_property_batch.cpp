@@ -0,0 +1,260 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "benchmarks/bench_property/test_properties.h"
+
+#include <rttr/type>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const std::size_t object_count = 10000;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_property_batch_get()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        std::vector<ns_foo::property_class> objects(object_count);
+        std::vector<int> values(object_count);
+
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < objects.size(); ++i)
+                values[i] = objects[i].int_value;
+            return values.data();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_property_batch_get()
+{
+    return nonius::benchmark("rttr", [](nonius::chronometer meter)
+    {
+        std::vector<ns_foo::property_class> objects(object_count);
+        std::vector<int> values(object_count);
+        rttr::property prop = rttr::type::get<ns_foo::property_class>().get_property("int_value");
+
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < objects.size(); ++i)
+                values[i] = prop.get_value(objects[i]).get_value<int>();
+            return values.data();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_property_batch_get_instances()
+{
+    return nonius::benchmark("rttr batch instances", [](nonius::chronometer meter)
+    {
+        std::vector<ns_foo::property_class> objects(object_count);
+        std::vector<rttr::instance> instances(objects.begin(), objects.end());
+        std::vector<int> values(object_count);
+        rttr::variant var = std::ref(values);
+        rttr::property prop = rttr::type::get<ns_foo::property_class>().get_property("int_value");
+
+        meter.measure([&]()
+        {
+            return prop.get_values({instances.data(), instances.size()}, var.create_sequential_view());
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_property_batch_get_stride()
+{
+    return nonius::benchmark("rttr batch stride", [](nonius::chronometer meter)
+    {
+        std::vector<ns_foo::property_class> objects(object_count);
+        std::vector<int> values(object_count);
+        rttr::property prop = rttr::type::get<ns_foo::property_class>().get_property("int_value");
+
+        meter.measure([&]()
+        {
+            return prop.get_values(objects.data(), sizeof(ns_foo::property_class), objects.size(), values.data());
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_property_batch_set()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        std::vector<ns_foo::property_class> objects(object_count);
+        std::vector<int> values(object_count, 42);
+
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < objects.size(); ++i)
+                objects[i].int_value = values[i];
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_property_batch_set()
+{
+    return nonius::benchmark("rttr", [](nonius::chronometer meter)
+    {
+        std::vector<ns_foo::property_class> objects(object_count);
+        std::vector<int> values(object_count, 42);
+        rttr::property prop = rttr::type::get<ns_foo::property_class>().get_property("int_value");
+
+        meter.measure([&]()
+        {
+            for (std::size_t i = 0; i < objects.size(); ++i)
+                prop.set_value(objects[i], values[i]);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_property_batch_set_instances()
+{
+    return nonius::benchmark("rttr batch instances", [](nonius::chronometer meter)
+    {
+        std::vector<ns_foo::property_class> objects(object_count);
+        std::vector<rttr::instance> instances(objects.begin(), objects.end());
+        std::vector<int> values(object_count, 42);
+        rttr::variant var = std::ref(values);
+        rttr::property prop = rttr::type::get<ns_foo::property_class>().get_property("int_value");
+
+        meter.measure([&]()
+        {
+            return prop.set_values({instances.data(), instances.size()}, var.create_sequential_view());
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_property_batch_set_stride()
+{
+    return nonius::benchmark("rttr batch stride", [](nonius::chronometer meter)
+    {
+        std::vector<ns_foo::property_class> objects(object_count);
+        std::vector<int> values(object_count, 42);
+        rttr::property prop = rttr::type::get<ns_foo::property_class>().get_property("int_value");
+
+        meter.measure([&]()
+        {
+            return prop.set_values(objects.data(), sizeof(ns_foo::property_class), objects.size(), values.data());
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_property_batch()
+{
+    nonius::configuration cfg;
+    cfg.title = "property batch access";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_property_batch.html");
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("get int - 10000 objects", "benchmark code:"
+                                                               "<pre>"
+                                                               "// Setup\n"
+                                                               "std::vector<Foo> objects(10000);\n"
+                                                               "std::vector<instance> instances(objects.begin(), objects.end());\n"
+                                                               "std::vector<int> values(10000);\n"
+                                                               "variant var = std::ref(values);\n"
+                                                               "// Benchmarking:\n\n"
+                                                               "// native approach\n"
+                                                               "for (std::size_t i = 0; i < objects.size(); ++i)\n"
+                                                               "    values[i] = objects[i].value;\n"
+                                                               "\n"
+                                                               "// rttr approach\n"
+                                                               "for (std::size_t i = 0; i < objects.size(); ++i)\n"
+                                                               "    values[i] = prop.get_value(objects[i]).get_value<int>();\n"
+                                                               "\n"
+                                                               "// rttr batch instances approach\n"
+                                                               "prop.get_values({instances.data(), instances.size()}, var.create_sequential_view());\n"
+                                                               "\n"
+                                                               "// rttr batch stride approach\n"
+                                                               "prop.get_values(objects.data(), sizeof(Foo), objects.size(), values.data());\n"
+                                                               "</pre>");
+    nonius::benchmark benchmarks_group_1[] = { bench_native_property_batch_get(),
+                                               bench_rttr_property_batch_get(),
+                                               bench_rttr_property_batch_get_instances(),
+                                               bench_rttr_property_batch_get_stride()};
+    // for unknown reason we have the run a pre-benchmark, otherwise we get wrong result (all samples are at: 0ns)
+    auto dummy_benchmark = nonius::benchmark_registry{bench_native_property_batch_get()};
+    nonius::go(cfg, dummy_benchmark);
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("set int - 10000 objects", "benchmark code:"
+                                                               "<pre>"
+                                                               "// Benchmarking:\n\n"
+                                                               "// native approach\n"
+                                                               "for (std::size_t i = 0; i < objects.size(); ++i)\n"
+                                                               "    objects[i].value = values[i];\n"
+                                                               "\n"
+                                                               "// rttr approach\n"
+                                                               "for (std::size_t i = 0; i < objects.size(); ++i)\n"
+                                                               "    prop.set_value(objects[i], values[i]);\n"
+                                                               "\n"
+                                                               "// rttr batch instances approach\n"
+                                                               "prop.set_values({instances.data(), instances.size()}, var.create_sequential_view());\n"
+                                                               "\n"
+                                                               "// rttr batch stride approach\n"
+                                                               "prop.set_values(objects.data(), sizeof(Foo), objects.size(), values.data());\n"
+                                                               "</pre>");
+    nonius::benchmark benchmarks_group_2[] = { bench_native_property_batch_set(),
+                                               bench_rttr_property_batch_set(),
+                                               bench_rttr_property_batch_set_instances(),
+                                               bench_rttr_property_batch_set_stride()};
+    nonius::go(cfg, std::begin(benchmarks_group_2), std::end(benchmarks_group_2), reporter);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,215 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "benchmarks/bench_property/test_properties.h"
+
+#include <rttr/type>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <cstring>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const std::size_t object_count = 1000;
+
+struct field_layout
+{
+    std::size_t offset;
+    std::size_t size;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::vector<ns_foo::transform_struct> create_transforms()
+{
+    std::vector<ns_foo::transform_struct> result(object_count);
+    int index = 0;
+    for (auto& item : result)
+    {
+        item.id = index;
+        item.x = static_cast<float>(index);
+        item.y = item.x * 2.0f;
+        item.z = item.x * 3.0f;
+        ++index;
+    }
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static char* write_value(char* out, const T& value)
+{
+    std::memcpy(out, &value, sizeof(T));
+    return out + sizeof(T);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_struct_packing()
+{
+    return nonius::benchmark("native", [](nonius::chronometer meter)
+    {
+        auto objects = create_transforms();
+        std::vector<char> buffer(objects.size() * sizeof(ns_foo::transform_struct));
+
+        meter.measure([&]()
+        {
+            char* out = buffer.data();
+            for (const auto& obj : objects)
+            {
+                out = write_value(out, obj.id);
+                out = write_value(out, obj.x);
+                out = write_value(out, obj.y);
+                out = write_value(out, obj.z);
+                out = write_value(out, obj.rot_x);
+                out = write_value(out, obj.rot_y);
+                out = write_value(out, obj.rot_z);
+                out = write_value(out, obj.rot_w);
+            }
+            return out;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_variant_struct_packing()
+{
+    return nonius::benchmark("rttr variant", [](nonius::chronometer meter)
+    {
+        auto objects = create_transforms();
+        std::vector<char> buffer(objects.size() * sizeof(ns_foo::transform_struct));
+        auto props = rttr::type::get<ns_foo::transform_struct>().get_properties();
+        const rttr::type float_type = rttr::type::get<float>();
+
+        meter.measure([&]()
+        {
+            char* out = buffer.data();
+            for (auto& obj : objects)
+            {
+                for (const auto& prop : props)
+                {
+                    const rttr::variant var = prop.get_value(obj);
+                    if (var.get_type() == float_type)
+                        out = write_value(out, var.get_value<float>());
+                    else
+                        out = write_value(out, var.get_value<int>());
+                }
+            }
+            return out;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_offset_struct_packing()
+{
+    return nonius::benchmark("rttr offset", [](nonius::chronometer meter)
+    {
+        auto objects = create_transforms();
+        std::vector<char> buffer(objects.size() * sizeof(ns_foo::transform_struct));
+        std::vector<field_layout> layout;
+        for (const auto& prop : rttr::type::get<ns_foo::transform_struct>().get_properties())
+        {
+            if (prop.is_trivially_copyable())
+                layout.push_back({prop.get_offset(), prop.get_type().get_sizeof()});
+        }
+
+        meter.measure([&]()
+        {
+            char* out = buffer.data();
+            for (const auto& obj : objects)
+            {
+                const char* src = reinterpret_cast<const char*>(&obj);
+                for (const auto& field : layout)
+                {
+                    std::memcpy(out, src + field.offset, field.size);
+                    out += field.size;
+                }
+            }
+            return out;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_property_packing()
+{
+    nonius::configuration cfg;
+    cfg.title = "property packing";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_property_packing.html");
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("pack 1000 objects", "benchmark code:"
+                                                         "<pre>"
+                                                         "// Foo.h\n"
+                                                         "struct Foo {\n"
+                                                         "    int id;\n"
+                                                         "    float x, y, z;\n"
+                                                         "    float rot_x, rot_y, rot_z, rot_w;\n"
+                                                         "};\n"
+                                                         "\n"
+                                                         "// Benchmarking:\n\n"
+                                                         "// native approach\n"
+                                                         "for (auto& obj : objects) {\n"
+                                                         "    out = write_value(out, obj.id);\n"
+                                                         "    out = write_value(out, obj.x); // ...\n"
+                                                         "}\n"
+                                                         "\n"
+                                                         "// rttr variant approach\n"
+                                                         "for (auto& obj : objects)\n"
+                                                         "    for (auto& prop : props)\n"
+                                                         "        out = write_value(out, prop.get_value(obj).get_value<float>());\n"
+                                                         "\n"
+                                                         "// rttr offset approach\n"
+                                                         "for (auto& obj : objects)\n"
+                                                         "    for (auto& field : layout) // offset and size from property::get_offset()\n"
+                                                         "        std::memcpy(out, src + field.offset, field.size);\n"
+                                                         "</pre>");
+    nonius::benchmark benchmarks_group_1[] = { bench_native_struct_packing(),
+                                               bench_rttr_variant_struct_packing(),
+                                               bench_rttr_offset_struct_packing()};
+    // for unknown reason we have the run a pre-benchmark, otherwise we get wrong result (all samples are at: 0ns)
+    auto dummy_benchmark = nonius::benchmark_registry{bench_native_struct_packing()};
+    nonius::go(cfg, dummy_benchmark);
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
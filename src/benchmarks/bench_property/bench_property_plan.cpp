@@ -0,0 +1,177 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "benchmarks/bench_property/test_properties.h"
+
+#include <rttr/type>
+#include <rttr/access_plan.h>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const std::size_t object_count = 1000;
+
+struct walk_result
+{
+    double      number_sum  = 0.0;
+    std::size_t text_length = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::vector<ns_foo::property_class> create_objects()
+{
+    std::vector<ns_foo::property_class> result(object_count);
+    int index = 0;
+    for (auto& item : result)
+    {
+        item.int_value = index;
+        item.double_value = index * 0.5;
+        item.string_value = std::to_string(index);
+        item.set_int_value(index);
+        item.set_string_value(item.string_value);
+        ++index;
+    }
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_property_walk_type_queries()
+{
+    return nonius::benchmark("rttr type queries", [](nonius::chronometer meter)
+    {
+        auto objects = create_objects();
+
+        meter.measure([&]()
+        {
+            walk_result result;
+            for (const auto& obj : objects)
+            {
+                rttr::instance inst = obj;
+                for (const auto& prop : inst.get_derived_type().get_properties())
+                {
+                    const rttr::variant value = prop.get_value(inst);
+                    const rttr::type t = value.get_type();
+                    if (t.is_arithmetic())
+                    {
+                        if (t == rttr::type::get<int>())
+                            result.number_sum += value.get_value<int>();
+                        else if (t == rttr::type::get<double>())
+                            result.number_sum += value.get_value<double>();
+                    }
+                    else if (t == rttr::type::get<std::string>())
+                    {
+                        result.text_length += value.get_value<std::string>().size();
+                    }
+                }
+            }
+            return result.number_sum + result.text_length;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_property_walk_access_plan()
+{
+    return nonius::benchmark("rttr access plan", [](nonius::chronometer meter)
+    {
+        auto objects = create_objects();
+        const auto plan = rttr::access_plan::get(rttr::type::get<ns_foo::property_class>());
+
+        meter.measure([&]()
+        {
+            walk_result result;
+            for (const auto& obj : objects)
+            {
+                rttr::instance inst = obj;
+                for (const auto& entry : plan.get_entries())
+                {
+                    switch (entry.get_kind())
+                    {
+                        case rttr::access_kind::int32:
+                            result.number_sum += entry.get_property().get_value(inst).get_value<int>();
+                            break;
+                        case rttr::access_kind::float64:
+                            result.number_sum += entry.get_property().get_value(inst).get_value<double>();
+                            break;
+                        case rttr::access_kind::string:
+                            result.text_length += entry.get_property().get_value(inst).get_value<std::string>().size();
+                            break;
+                        default:
+                            break;
+                    }
+                }
+            }
+            return result.number_sum + result.text_length;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_property_plan()
+{
+    nonius::configuration cfg;
+    cfg.title = "property access plan";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_property_plan.html");
+
+    /////////////////////////////////////
+
+    reporter.set_current_group_name("walk all properties of 1000 objects", "benchmark code:"
+                                                                          "<pre>"
+                                                                          "// rttr type queries approach\n"
+                                                                          "for (auto& prop : obj.get_derived_type().get_properties()) {\n"
+                                                                          "    variant value = prop.get_value(obj);\n"
+                                                                          "    if (value.get_type() == type::get<int>()) // ...\n"
+                                                                          "}\n"
+                                                                          "\n"
+                                                                          "// rttr access plan approach\n"
+                                                                          "for (auto& entry : plan.get_entries()) {\n"
+                                                                          "    switch (entry.get_kind()) {\n"
+                                                                          "        case access_kind::int32: // ...\n"
+                                                                          "    }\n"
+                                                                          "}\n"
+                                                                          "</pre>");
+    nonius::benchmark benchmarks_group_1[] = { bench_rttr_property_walk_type_queries(),
+                                               bench_rttr_property_walk_access_plan()};
+    // for unknown reason we have the run a pre-benchmark, otherwise we get wrong result (all samples are at: 0ns)
+    auto dummy_benchmark = nonius::benchmark_registry{bench_rttr_property_walk_type_queries()};
+    nonius::go(cfg, dummy_benchmark);
+    nonius::go(cfg, std::begin(benchmarks_group_1), std::end(benchmarks_group_1), reporter);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,107 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "benchmarks/bench_property/test_properties.h"
+
+#include <rttr/registration>
+
+
+RTTR_REGISTRATION
+{
+    using namespace rttr;
+
+    registration::class_<ns_foo::property_class>("ns_foo::property_class")
+        .constructor<>()
+        .property("int_value",      &ns_foo::property_class::int_value)
+        .property("double_value",   &ns_foo::property_class::double_value)
+        .property("string_value",   &ns_foo::property_class::string_value)
+        .property("int_func",       &ns_foo::property_class::get_int_value,    &ns_foo::property_class::set_int_value)
+        .property("string_func",    &ns_foo::property_class::get_string_value, &ns_foo::property_class::set_string_value)
+        ;
+
+    registration::class_<ns_foo::transform_struct>("ns_foo::transform_struct")
+        .property("id",     &ns_foo::transform_struct::id)
+        .property("x",      &ns_foo::transform_struct::x)
+        .property("y",      &ns_foo::transform_struct::y)
+        .property("z",      &ns_foo::transform_struct::z)
+        .property("rot_x",  &ns_foo::transform_struct::rot_x)
+        .property("rot_y",  &ns_foo::transform_struct::rot_y)
+        .property("rot_z",  &ns_foo::transform_struct::rot_z)
+        .property("rot_w",  &ns_foo::transform_struct::rot_w)
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ns_foo
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+property_class::property_class()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+property_class::~property_class()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+int property_class::get_int_value() const
+{
+    return m_int_value;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void property_class::set_int_value(int value)
+{
+    m_int_value = value;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const std::string& property_class::get_string_value() const
+{
+    return m_string_value;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void property_class::set_string_value(const std::string& value)
+{
+    m_string_value = value;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace ns_foo
@@ -0,0 +1,73 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_TEST_PROPERTIES_H_
+#define RTTR_TEST_PROPERTIES_H_
+
+#include <rttr/type>
+
+#include <string>
+
+namespace ns_foo
+{
+
+struct property_class
+{
+    property_class();
+    virtual ~property_class();
+
+    int get_int_value() const;
+    void set_int_value(int value);
+
+    const std::string& get_string_value() const;
+    void set_string_value(const std::string& value);
+
+    int         int_value    = 0;
+    double      double_value = 0.0;
+    std::string string_value;
+
+    RTTR_ENABLE()
+private:
+    int         m_int_value = 0;
+    std::string m_string_value;
+};
+
+struct transform_struct
+{
+    int     id      = 0;
+    float   x       = 0.0f;
+    float   y       = 0.0f;
+    float   z       = 0.0f;
+    float   rot_x   = 0.0f;
+    float   rot_y   = 0.0f;
+    float   rot_z   = 0.0f;
+    float   rot_w   = 1.0f;
+};
+
+} // end namespace ns_foo
+
+#endif // RTTR_TEST_PROPERTIES_H_
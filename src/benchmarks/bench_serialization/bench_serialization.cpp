@@ -0,0 +1,334 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/type>
+#include <rttr/registration>
+#include <rttr/binary_serialization.h>
+#include <rttr/binary_view.h>
+#include <rttr/json_serialization.h>
+
+#include "to_json.h"
+#include "from_json.h"
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+enum class asset_kind
+{
+    mesh,
+    texture,
+    sound
+};
+
+struct asset_vector
+{
+    asset_vector() {}
+    asset_vector(double x_, double y_, double z_) : x(x_), y(y_), z(z_) {}
+
+    double x = 0.0;
+    double y = 0.0;
+    double z = 0.0;
+};
+
+struct asset_node
+{
+    asset_node() {}
+
+    int                         id = 0;
+    std::string                 name;
+    asset_kind                  kind = asset_kind::mesh;
+    bool                        visible = true;
+    asset_vector                position;
+    asset_vector                scale;
+    std::vector<double>         weights;
+    std::vector<std::string>    tags;
+    std::map<std::string, int>  attributes;
+};
+
+struct asset_scene
+{
+    std::string                 name;
+    std::vector<asset_node>     nodes;
+};
+
+RTTR_REGISTRATION
+{
+    using namespace rttr;
+
+    registration::enumeration<asset_kind>("asset_kind")
+    (
+        value("mesh",       asset_kind::mesh),
+        value("texture",    asset_kind::texture),
+        value("sound",      asset_kind::sound)
+    );
+
+    registration::class_<asset_vector>("asset_vector")
+        .constructor<>()(policy::ctor::as_object)
+        .property("x", &asset_vector::x)
+        .property("y", &asset_vector::y)
+        .property("z", &asset_vector::z);
+
+    registration::class_<asset_node>("asset_node")
+        .constructor<>()(policy::ctor::as_object)
+        .property("id", &asset_node::id)
+        .property("name", &asset_node::name)
+        .property("kind", &asset_node::kind)
+        .property("visible", &asset_node::visible)
+        .property("position", &asset_node::position)
+        .property("scale", &asset_node::scale)
+        .property("weights", &asset_node::weights)
+        .property("tags", &asset_node::tags)
+        .property("attributes", &asset_node::attributes);
+
+    registration::class_<asset_scene>("asset_scene")
+        .property("name", &asset_scene::name)
+        .property("nodes", &asset_scene::nodes);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const int node_count = 1000;
+// every n-th node is accessed by the lazy read benchmarks
+static const int node_step = 100;
+
+static asset_scene create_scene()
+{
+    asset_scene scene;
+    scene.name = "benchmark scene";
+    scene.nodes.resize(node_count);
+    for (int i = 0; i < node_count; ++i)
+    {
+        auto& node = scene.nodes[i];
+        node.id = i;
+        node.name = "node_" + std::to_string(i);
+        node.kind = static_cast<asset_kind>(i % 3);
+        node.visible = (i % 2 == 0);
+        node.position = asset_vector(i * 1.5, i * 2.5, i * 3.5);
+        node.scale = asset_vector(1.0, 1.0, 1.0);
+        node.weights = {0.25, 0.5, 0.75, 1.0};
+        node.tags = {"static", "layer_" + std::to_string(i % 8)};
+        node.attributes = {{"lod", i % 4}, {"priority", i % 16}};
+    }
+
+    return scene;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_json_write()
+{
+    return nonius::benchmark("json example", [](nonius::chronometer meter)
+    {
+        const auto scene = create_scene();
+        std::string result;
+        meter.measure([&]()
+        {
+            result = io::to_json(scene);
+            return result.size();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_binary_write()
+{
+    return nonius::benchmark("rttr binary", [](nonius::chronometer meter)
+    {
+        const auto scene = create_scene();
+        std::vector<std::uint8_t> buffer;
+        meter.measure([&]()
+        {
+            buffer.clear();
+            rttr::to_binary(scene, buffer);
+            return buffer.size();
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_json_read()
+{
+    return nonius::benchmark("json example", [](nonius::chronometer meter)
+    {
+        const auto source = create_scene();
+        const auto json = io::to_json(source);
+        asset_scene scene;
+        meter.measure([&]()
+        {
+            return io::from_json(json, scene);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_json_read()
+{
+    return nonius::benchmark("rttr::from_json()", [](nonius::chronometer meter)
+    {
+        const auto source = create_scene();
+        const auto json = io::to_json(source);
+        asset_scene scene;
+        meter.measure([&]()
+        {
+            return rttr::from_json(json, scene);
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_binary_read()
+{
+    return nonius::benchmark("rttr binary", [](nonius::chronometer meter)
+    {
+        const auto source = create_scene();
+        std::vector<std::uint8_t> buffer;
+        rttr::to_binary(source, buffer);
+        asset_scene scene;
+        meter.measure([&]()
+        {
+            return rttr::from_binary(buffer.data(), buffer.size(), scene);
+        });
+    });
+}
+
+nonius::benchmark bench_binary_full_access()
+{
+    return nonius::benchmark("rttr::from_binary()", [](nonius::chronometer meter)
+    {
+        const auto source = create_scene();
+        std::vector<std::uint8_t> buffer;
+        rttr::to_binary(source, buffer);
+        asset_scene scene;
+        meter.measure([&]()
+        {
+            rttr::from_binary(buffer.data(), buffer.size(), scene);
+            std::size_t length = 0;
+            for (int i = 0; i < node_count; i += node_step)
+                length += scene.nodes[i].name.size();
+            return length;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_binary_view_access()
+{
+    return nonius::benchmark("rttr::binary_view", [](nonius::chronometer meter)
+    {
+        const auto source = create_scene();
+        std::vector<std::uint8_t> buffer;
+        rttr::to_binary(source, buffer);
+        const auto t = rttr::type::get<asset_scene>();
+        meter.measure([&]()
+        {
+            rttr::binary_view scene(buffer.data(), buffer.size(), t);
+            std::size_t length = 0;
+            for (int i = 0; i < node_count; i += node_step)
+                length += scene.get_item("nodes", i).get_string("name").size();
+            return length;
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_serialization()
+{
+    nonius::configuration cfg;
+    cfg.title = "rttr binary serialization vs. json example";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_serialization.html");
+
+    std::vector<std::uint8_t> buffer;
+    const auto scene = create_scene();
+    rttr::to_binary(scene, buffer);
+    const auto json = io::to_json(scene);
+    const auto size_text = "A scene with " + std::to_string(node_count) + " nodes; the binary data has " +
+                           std::to_string(buffer.size()) + " bytes, the json data " + std::to_string(json.size()) + " bytes.";
+
+    reporter.set_current_group_name("write", size_text +
+                                    "<pre>"
+                                    "// json approach\n"
+                                    "std::string json = io::to_json(scene);\n"
+                                    "\n"
+                                    "// rttr binary approach\n"
+                                    "std::vector<std::uint8_t> buffer;\n"
+                                    "rttr::to_binary(scene, buffer);\n"
+                                    "</pre>");
+    nonius::benchmark write_benchmarks[] = { bench_json_write(),
+                                             bench_binary_write() };
+    nonius::go(cfg, std::begin(write_benchmarks), std::end(write_benchmarks), reporter);
+
+    reporter.set_current_group_name("read", size_text +
+                                    "<pre>"
+                                    "// json approach\n"
+                                    "io::from_json(json, scene);\n"
+                                    "\n"
+                                    "// rttr json approach\n"
+                                    "rttr::from_json(json, scene);\n"
+                                    "\n"
+                                    "// rttr binary approach\n"
+                                    "rttr::from_binary(buffer.data(), buffer.size(), scene);\n"
+                                    "</pre>");
+    nonius::benchmark read_benchmarks[] = { bench_json_read(),
+                                            bench_rttr_json_read(),
+                                            bench_binary_read() };
+    nonius::go(cfg, std::begin(read_benchmarks), std::end(read_benchmarks), reporter);
+
+    reporter.set_current_group_name("lazy read", size_text + " The name of every " + std::to_string(node_step) + "th node is accessed."
+                                    "<pre>"
+                                    "// full approach\n"
+                                    "rttr::from_binary(buffer.data(), buffer.size(), scene);\n"
+                                    "scene.nodes[i].name;\n"
+                                    "\n"
+                                    "// view approach\n"
+                                    "rttr::binary_view scene(buffer.data(), buffer.size(), type::get<asset_scene>());\n"
+                                    "scene.get_item(\"nodes\", i).get_string(\"name\");\n"
+                                    "</pre>");
+    nonius::benchmark lazy_benchmarks[] = { bench_binary_full_access(),
+                                            bench_binary_view_access() };
+    nonius::go(cfg, std::begin(lazy_benchmarks), std::end(lazy_benchmarks), reporter);
+
+    reporter.generate_report();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
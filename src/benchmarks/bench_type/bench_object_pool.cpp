@@ -0,0 +1,252 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/type>
+#include <rttr/registration>
+
+#include <nonius/nonius.h++>
+#include <nonius/html_group_reporter.h>
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct pooled_object
+{
+    int         m_data_i = 0;
+    double      m_data_d = 0.0;
+    std::string m_text;
+};
+
+RTTR_REGISTRATION
+{
+    rttr::registration::class_<pooled_object>("pooled_object")
+        .constructor<>()
+        (
+            rttr::policy::ctor::as_raw_ptr
+        );
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const int ops_per_thread = 10000;
+// the amount of objects a thread holds at the same time
+static const int live_objects = 8;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * A team of persistent worker threads, so the creation of the threads is not part of the measurement.
+ * \ref run() starts the given job on all workers at the same time and waits until every worker has finished it.
+ */
+class worker_team
+{
+public:
+    explicit worker_team(int thread_count)
+    {
+        m_threads.reserve(thread_count);
+        for (int t = 0; t < thread_count; ++t)
+            m_threads.emplace_back([this]() { work(); });
+    }
+
+    ~worker_team()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_start_cond.notify_all();
+
+        for (auto& thread : m_threads)
+            thread.join();
+    }
+
+    void run(const std::function<void()>& job)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_job = &job;
+        m_pending = static_cast<int>(m_threads.size());
+        ++m_generation;
+        m_start_cond.notify_all();
+        m_done_cond.wait(lock, [this]() { return m_pending == 0; });
+    }
+
+private:
+    void work()
+    {
+        std::size_t generation = 0;
+        while (true)
+        {
+            const std::function<void()>* job = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_start_cond.wait(lock, [&]() { return m_stop || m_generation != generation; });
+                if (m_stop)
+                    return;
+
+                generation = m_generation;
+                job = m_job;
+            }
+
+            (*job)();
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (--m_pending == 0)
+                m_done_cond.notify_one();
+        }
+    }
+
+private:
+    std::vector<std::thread>        m_threads;
+    std::mutex                      m_mutex;
+    std::condition_variable         m_start_cond;
+    std::condition_variable         m_done_cond;
+    const std::function<void()>*    m_job = nullptr;
+    std::size_t                     m_generation = 0;
+    int                             m_pending = 0;
+    bool                            m_stop = false;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Create_Func, typename Destroy_Func>
+static void run_create_destroy(worker_team& team, const Create_Func& create_func, const Destroy_Func& destroy_func)
+{
+    const std::function<void()> job = [&create_func, &destroy_func]()
+    {
+        rttr::variant objects[live_objects];
+        for (int i = 0; i < ops_per_thread; i += live_objects)
+        {
+            for (auto& obj : objects)
+                obj = create_func();
+
+            for (auto& obj : objects)
+                destroy_func(obj);
+        }
+    };
+
+    team.run(job);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_native_create_destroy(int thread_count)
+{
+    return nonius::benchmark("native new/delete", [thread_count](nonius::chronometer meter)
+    {
+        worker_team team(thread_count);
+        meter.measure([&]()
+        {
+            run_create_destroy(team,
+                               []() { return rttr::variant(new pooled_object()); },
+                               [](rttr::variant& obj) { delete obj.get_value<pooled_object*>(); obj = rttr::variant(); });
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_type_create_destroy(int thread_count)
+{
+    return nonius::benchmark("rttr::type::create()", [thread_count](nonius::chronometer meter)
+    {
+        rttr::type t = rttr::type::get_by_name("pooled_object");
+        worker_team team(thread_count);
+        meter.measure([&]()
+        {
+            run_create_destroy(team,
+                               [&t]() { return t.create(); },
+                               [&t](rttr::variant& obj) { t.destroy(obj); });
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+nonius::benchmark bench_rttr_object_pool_create_destroy(int thread_count)
+{
+    return nonius::benchmark("rttr::object_pool::create()", [thread_count](nonius::chronometer meter)
+    {
+        rttr::object_pool pool(rttr::type::get_by_name("pooled_object"));
+        worker_team team(thread_count);
+        meter.measure([&]()
+        {
+            run_create_destroy(team,
+                               [&pool]() { return pool.create(); },
+                               [&pool](rttr::variant& obj) { pool.destroy(obj); });
+        });
+    });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void bench_object_pool()
+{
+    nonius::configuration cfg;
+    cfg.title = "rttr::object_pool create/destroy throughput";
+
+    nonius::html_group_reporter reporter;
+    reporter.set_output_file("benchmark_object_pool.html");
+
+    for (int thread_count : {1, 2, 4, 8, 16, 32})
+    {
+        const auto group_name = std::to_string(thread_count) + (thread_count == 1 ? " thread" : " threads");
+        reporter.set_current_group_name(group_name,
+                                        "Every thread of a persistent worker team creates and destroys " + std::to_string(ops_per_thread) +
+                                        " objects, holding " + std::to_string(live_objects) + " objects at the same time; "
+                                        "the creation of the threads is not measured."
+                                        "<pre>"
+                                        "// Setup\n"
+                                        "rttr::type t = rttr::type::get_by_name(\"pooled_object\");\n"
+                                        "rttr::object_pool pool(t);\n"
+                                        "// Benchmarking:\n\n"
+                                        "// native approach\n"
+                                        "auto obj = new pooled_object(); delete obj;\n"
+                                        "\n"
+                                        "// rttr type approach\n"
+                                        "rttr::variant obj = t.create(); t.destroy(obj);\n"
+                                        "\n"
+                                        "// rttr pool approach\n"
+                                        "rttr::variant obj = pool.create(); pool.destroy(obj);\n"
+                                        "</pre>");
+        nonius::benchmark benchmarks[] = { bench_native_create_destroy(thread_count),
+                                           bench_rttr_type_create_destroy(thread_count),
+                                           bench_rttr_object_pool_create_destroy(thread_count)};
+        nonius::go(cfg, std::begin(benchmarks), std::end(benchmarks), reporter);
+    }
+
+    reporter.generate_report();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,568 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/access_plan.h"
+#include "rttr/detail/access_plan/access_plan_p.h"
+#include "rttr/detail/type/type_register_p.h"
+
+#include <algorithm>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+/*!
+ * The plans of all types, which were requested so far.
+ * The cache is cleared, whenever the content of the type registry changes.
+ */
+struct access_plan_cache
+{
+    std::mutex                                          m_mutex;
+    std::size_t                                         m_version = 0;
+    std::unordered_map<type::type_id, access_plan>      m_plans;
+};
+
+access_plan_cache& get_access_plan_cache()
+{
+    static access_plan_cache cache;
+    return cache;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+access_kind get_arithmetic_kind()
+{
+    if (std::is_same<T, bool>::value)
+        return access_kind::boolean;
+    else if (std::is_same<T, char>::value)
+        return access_kind::character;
+    else if (std::is_same<T, float>::value)
+        return access_kind::float32;
+    else if (std::is_same<T, double>::value)
+        return access_kind::float64;
+    else if (!std::is_integral<T>::value)
+        return access_kind::other;
+
+    switch (sizeof(T))
+    {
+        case 1: return (std::is_signed<T>::value ? access_kind::int8 : access_kind::uint8);
+        case 2: return (std::is_signed<T>::value ? access_kind::int16 : access_kind::uint16);
+        case 4: return (std::is_signed<T>::value ? access_kind::int32 : access_kind::uint32);
+        case 8: return (std::is_signed<T>::value ? access_kind::int64 : access_kind::uint64);
+        default: return access_kind::other;
+    }
+}
+
+template<typename T>
+std::pair<type, access_kind> make_arithmetic_kind()
+{
+    return std::make_pair(type::get<T>(), get_arithmetic_kind<T>());
+}
+
+access_kind get_arithmetic_kind(const type& t)
+{
+    static const std::pair<type, access_kind> kinds[] =
+    {
+        make_arithmetic_kind<bool>(),
+        make_arithmetic_kind<char>(),
+        make_arithmetic_kind<signed char>(),
+        make_arithmetic_kind<unsigned char>(),
+        make_arithmetic_kind<wchar_t>(),
+        make_arithmetic_kind<char16_t>(),
+        make_arithmetic_kind<char32_t>(),
+        make_arithmetic_kind<short>(),
+        make_arithmetic_kind<unsigned short>(),
+        make_arithmetic_kind<int>(),
+        make_arithmetic_kind<unsigned int>(),
+        make_arithmetic_kind<long>(),
+        make_arithmetic_kind<unsigned long>(),
+        make_arithmetic_kind<long long>(),
+        make_arithmetic_kind<unsigned long long>(),
+        make_arithmetic_kind<float>(),
+        make_arithmetic_kind<double>()
+    };
+
+    for (const auto& item : kinds)
+    {
+        if (item.first == t)
+            return item.second;
+    }
+
+    return access_kind::other;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Calculates a FNV-1a hash, which is independent of the platform.
+ */
+struct fingerprint_hash
+{
+    void add(const void* data, std::size_t size)
+    {
+        const auto bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            m_value ^= bytes[i];
+            m_value *= 1099511628211ull;
+        }
+    }
+
+    void add(string_view text)
+    {
+        add(text.data(), text.size());
+        add(static_cast<std::uint64_t>(text.size()));
+    }
+
+    void add(std::uint64_t value)
+    {
+        unsigned char bytes[8];
+        for (std::size_t i = 0; i < 8; ++i)
+            bytes[i] = static_cast<unsigned char>(value >> (i * 8));
+
+        add(bytes, sizeof(bytes));
+    }
+
+    std::uint64_t m_value = 14695981039346656037ull;
+};
+
+} // end namespace anonymous
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+access_plan access_plan_private::get(const type& t)
+{
+    if (!t.is_valid())
+        return access_plan();
+
+    const auto raw_type = t.get_raw_type();
+    const auto version  = type_register_private::get_instance().get_registration_version();
+
+    auto& cache = get_access_plan_cache();
+    std::lock_guard<std::mutex> lock(cache.m_mutex);
+
+    if (cache.m_version != version)
+    {
+        cache.m_plans.clear();
+        cache.m_version = version;
+    }
+
+    auto itr = cache.m_plans.find(raw_type.get_id());
+    if (itr != cache.m_plans.end())
+        return itr->second;
+
+    auto plan = compile(raw_type);
+    // the plans of the nested objects are compiled anyway, so we cache them too
+    for (const auto& node : plan.m_graph->m_nodes)
+        cache.m_plans.emplace(node->m_type.get_id(), access_plan(plan.m_graph, node.get()));
+
+    return plan;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+access_plan access_plan_private::compile(const type& t)
+{
+    auto graph = std::make_shared<access_plan_graph>();
+    std::unordered_map<type::type_id, access_plan_node*> node_list;
+    std::vector<access_plan_node*> pending_nodes;
+
+    auto get_node = [&](const type& node_type)
+    {
+        auto itr = node_list.find(node_type.get_id());
+        if (itr != node_list.end())
+            return itr->second;
+
+        graph->m_nodes.emplace_back(new access_plan_node(node_type));
+        auto node = graph->m_nodes.back().get();
+        node_list.emplace(node_type.get_id(), node);
+        pending_nodes.push_back(node);
+        return node;
+    };
+
+    auto root = get_node(t);
+    while (!pending_nodes.empty())
+    {
+        auto node = pending_nodes.back();
+        pending_nodes.pop_back();
+
+        const auto prop_list = node->m_type.get_properties();
+        node->m_entries.reserve(prop_list.size());
+        for (const auto& prop : prop_list)
+        {
+            access_plan_entry entry(prop, graph.get());
+            const auto nested_type = get_nested_type(entry);
+            if (nested_type.is_valid())
+                entry.m_nested = get_node(nested_type);
+
+            node->m_entry_index.insert(prop.get_name(), node->m_entries.size());
+            node->m_entries.push_back(entry);
+        }
+    }
+
+    for (auto& node : graph->m_nodes)
+        node->m_fingerprint = get_fingerprint(node.get());
+
+    return access_plan(graph, root);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::uint64_t access_plan_private::get_fingerprint(const access_plan_node* root)
+{
+    // nested plans, which were already visited, are identified by their position in the visiting order,
+    // so the result does not depend on memory addresses and is finite for recursive types
+    fingerprint_hash hash;
+    std::unordered_map<const access_plan_node*, std::uint64_t> visited_nodes;
+    std::vector<const access_plan_node*> pending_nodes = {root};
+
+    while (!pending_nodes.empty())
+    {
+        auto node = pending_nodes.back();
+        pending_nodes.pop_back();
+
+        visited_nodes.emplace(node, visited_nodes.size());
+        hash.add(node->m_type.get_name());
+        hash.add(static_cast<std::uint64_t>(node->m_entries.size()));
+
+        std::vector<const access_plan_node*> nested_nodes;
+        for (const auto& entry : node->m_entries)
+        {
+            hash.add(entry.m_property.get_name());
+            hash.add(entry.m_value_type.get_name());
+            hash.add(static_cast<std::uint64_t>(entry.m_kind));
+            hash.add(static_cast<std::uint64_t>(entry.m_wrapped_kind));
+
+            if (!entry.m_nested)
+            {
+                hash.add(std::numeric_limits<std::uint64_t>::max());
+                continue;
+            }
+
+            auto itr = visited_nodes.find(entry.m_nested);
+            if (itr != visited_nodes.end())
+            {
+                hash.add(itr->second);
+            }
+            else if (std::find(nested_nodes.begin(), nested_nodes.end(), entry.m_nested) == nested_nodes.end())
+            {
+                // the nested plans are visited in declaration order after this node
+                hash.add(std::numeric_limits<std::uint64_t>::max() - 1);
+                nested_nodes.push_back(entry.m_nested);
+            }
+        }
+
+        for (auto itr = nested_nodes.rbegin(); itr != nested_nodes.rend(); ++itr)
+        {
+            if (std::find(pending_nodes.begin(), pending_nodes.end(), *itr) == pending_nodes.end())
+                pending_nodes.push_back(*itr);
+        }
+    }
+
+    return hash.m_value;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void* access_plan_private::get_member_address(const access_plan_entry& entry, const instance& obj) RTTR_NOEXCEPT
+{
+    if (!entry.m_has_offset)
+        return nullptr;
+
+    const auto& data = obj.m_data_container;
+    const auto declaring_type = entry.m_property.get_declaring_type();
+    void* ptr = type::apply_offset(data.m_data_address, data.m_type, declaring_type);
+    if (!ptr)
+        ptr = type::apply_offset(data.m_data_address_wrapped_type, data.m_wrapped_type, declaring_type);
+
+    return (ptr ? static_cast<char*>(ptr) + entry.m_offset : nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+instance access_plan_private::get_member(const access_plan_entry& entry, const instance& obj) RTTR_NOEXCEPT
+{
+    instance member;
+    if (void* ptr = get_member_address(entry, obj))
+        member.m_data_container = data_address_container{entry.m_value_type, type::get<invalid_wrapper_type>(), ptr, ptr};
+
+    return member;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type access_plan_private::get_nested_type(const access_plan_entry& entry)
+{
+    switch (entry.m_kind)
+    {
+        case access_kind::object:
+        case access_kind::pointer:
+        case access_kind::wrapper:
+        {
+            return get_object_type(entry.m_value_type);
+        }
+        case access_kind::sequential_container:
+        {
+            // the item type of the standard containers is the first template argument
+            const auto arg_list = entry.m_value_type.get_template_arguments();
+            if (!arg_list.empty())
+                return get_object_type(*arg_list.begin());
+
+            break;
+        }
+        default:
+            break;
+    }
+
+    return get_invalid_type();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type access_plan_private::get_object_type(const type& t)
+{
+    const auto value_type = t.is_wrapper() ? t.get_wrapped_type() : t;
+    const auto raw_type = value_type.get_raw_type();
+    if (access_plan::get_kind(raw_type) == access_kind::object)
+        return raw_type;
+    else
+        return get_invalid_type();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+access_plan_entry::access_plan_entry(const property& prop, const detail::access_plan_graph* graph) RTTR_NOEXCEPT
+:   m_property(prop),
+    m_value_type(prop.get_type()),
+    m_kind(access_plan::get_kind(m_value_type)),
+    m_wrapped_kind(m_kind == access_kind::wrapper ? access_plan::get_kind(m_value_type.get_wrapped_type()) : m_kind),
+    m_has_offset(prop.has_offset()),
+    m_offset(m_has_offset ? prop.get_offset() : 0),
+    m_nested(nullptr),
+    m_graph(graph)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const property& access_plan_entry::get_property() const RTTR_NOEXCEPT
+{
+    return m_property;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type access_plan_entry::get_value_type() const RTTR_NOEXCEPT
+{
+    return m_value_type;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+access_kind access_plan_entry::get_kind() const RTTR_NOEXCEPT
+{
+    return m_kind;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+access_kind access_plan_entry::get_wrapped_kind() const RTTR_NOEXCEPT
+{
+    return m_wrapped_kind;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool access_plan_entry::has_offset() const RTTR_NOEXCEPT
+{
+    return m_has_offset;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t access_plan_entry::get_offset() const RTTR_NOEXCEPT
+{
+    return m_offset;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+access_plan access_plan_entry::get_nested_plan() const
+{
+    if (m_nested)
+        return access_plan(m_graph->shared_from_this(), m_nested);
+    else
+        return access_plan();
+}
+
+void* access_plan_entry::get_member_address(const instance& obj) const RTTR_NOEXCEPT
+{
+    return detail::access_plan_private::get_member_address(*this, obj);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+instance access_plan_entry::get_member(const instance& obj) const RTTR_NOEXCEPT
+{
+    return detail::access_plan_private::get_member(*this, obj);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+access_plan::access_plan() RTTR_NOEXCEPT
+:   m_node(nullptr)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+access_plan::access_plan(std::shared_ptr<const detail::access_plan_graph> graph, const detail::access_plan_node* node) RTTR_NOEXCEPT
+:   m_graph(std::move(graph)),
+    m_node(node)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+access_plan access_plan::get(const type& t)
+{
+    return detail::access_plan_private::get(t);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+access_kind access_plan::get_kind(const type& t) RTTR_NOEXCEPT
+{
+    if (!t.is_valid())
+        return access_kind::other;
+    else if (t.is_wrapper())
+        return access_kind::wrapper;
+    else if (t.is_pointer())
+        return (t.is_function_pointer() ? access_kind::other : access_kind::pointer);
+    else if (t.is_arithmetic())
+        return detail::get_arithmetic_kind(t);
+    else if (t.is_enumeration())
+        return access_kind::enumeration;
+    else if (t == type::get<std::string>())
+        return access_kind::string;
+    else if (t.is_sequential_container())
+        return access_kind::sequential_container;
+    else if (t.is_associative_container())
+        return access_kind::associative_container;
+    else if (t.is_class())
+        return access_kind::object;
+    else
+        return access_kind::other;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool access_plan::is_valid() const RTTR_NOEXCEPT
+{
+    return (m_node != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+access_plan::operator bool() const RTTR_NOEXCEPT
+{
+    return (m_node != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type access_plan::get_type() const RTTR_NOEXCEPT
+{
+    return (m_node ? m_node->m_type : detail::get_invalid_type());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+array_range<access_plan_entry> access_plan::get_entries() const RTTR_NOEXCEPT
+{
+    if (m_node && !m_node->m_entries.empty())
+        return array_range<access_plan_entry>(m_node->m_entries.data(), m_node->m_entries.size());
+    else
+        return array_range<access_plan_entry>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const access_plan_entry* access_plan::find_entry(string_view name) const RTTR_NOEXCEPT
+{
+    if (!m_node)
+        return nullptr;
+
+    const auto itr = m_node->m_entry_index.find(name);
+    return (itr != m_node->m_entry_index.end() ? &m_node->m_entries[*itr] : nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::uint64_t access_plan::get_fingerprint() const RTTR_NOEXCEPT
+{
+    return (m_node ? m_node->m_fingerprint : 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool access_plan::operator==(const access_plan& other) const RTTR_NOEXCEPT
+{
+    return (m_node == other.m_node);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool access_plan::operator!=(const access_plan& other) const RTTR_NOEXCEPT
+{
+    return (m_node != other.m_node);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
@@ -0,0 +1,339 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_ACCESS_PLAN_H_
+#define RTTR_ACCESS_PLAN_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include "rttr/type.h"
+#include "rttr/property.h"
+#include "rttr/instance.h"
+#include "rttr/array_range.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace rttr
+{
+class access_plan;
+
+namespace detail
+{
+struct access_plan_node;
+struct access_plan_graph;
+class access_plan_private;
+} // end namespace detail
+
+/*!
+ * The \ref access_kind describes how the value of a \ref type can be accessed by a generic algorithm,
+ * e.g. a serializer, a hash function or a comparator.
+ *
+ * The arithmetic kinds are determined by the size and signedness of the type, not by its name;
+ * e.g. `long` and `long long` are both \ref access_kind::int64 on platforms where both have 64 bits.
+ */
+enum class access_kind : std::uint8_t
+{
+    boolean,                //!< The type is `bool`.
+    character,              //!< The type is `char`.
+    int8,                   //!< The type is a signed integer with 8 bits.
+    int16,                  //!< The type is a signed integer with 16 bits.
+    int32,                  //!< The type is a signed integer with 32 bits.
+    int64,                  //!< The type is a signed integer with 64 bits.
+    uint8,                  //!< The type is an unsigned integer with 8 bits.
+    uint16,                 //!< The type is an unsigned integer with 16 bits.
+    uint32,                 //!< The type is an unsigned integer with 32 bits.
+    uint64,                 //!< The type is an unsigned integer with 64 bits.
+    float32,                //!< The type is `float`.
+    float64,                //!< The type is `double`.
+    enumeration,            //!< The type is an enumeration, see \ref type::is_enumeration().
+    string,                 //!< The type is `std::string`.
+    sequential_container,   //!< The type is a sequential container, see \ref type::is_sequential_container().
+    associative_container,  //!< The type is an associative container, see \ref type::is_associative_container().
+    wrapper,                //!< The type is a wrapper, see \ref type::is_wrapper().
+    pointer,                //!< The type is a pointer to an object, see \ref type::is_pointer().
+    object,                 //!< The type is a class, which values are accessed through its properties.
+    other                   //!< The value can only be accessed as a whole, e.g. with \ref variant::to_string().
+};
+
+/*!
+ * The \ref access_plan_entry class describes how to access one property in an \ref access_plan.
+ *
+ * All information is gathered when the plan is compiled; retrieving it does not query the type system again.
+ */
+class RTTR_API access_plan_entry
+{
+public:
+    /*!
+     * \brief Returns the property, which is accessed by this entry.
+     *
+     * \return The property of this entry.
+     */
+    const property& get_property() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns the \ref property::get_type() "type" of the property.
+     *
+     * \return The type of the property value.
+     */
+    type get_value_type() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns how the value of the property can be accessed.
+     *
+     * \return The access kind of the property value.
+     */
+    access_kind get_kind() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns for an entry of kind \ref access_kind::wrapper the access kind of the wrapped type;
+     *        otherwise the same as \ref get_kind().
+     *
+     * \return The access kind of the wrapped value.
+     */
+    access_kind get_wrapped_kind() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns true, when the property is a member object and its \ref property::get_offset() "offset" is known.
+     *
+     * \return True, when \ref get_offset() can be used; otherwise false.
+     */
+    bool has_offset() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns the \ref property::get_offset() "offset" of the member object,
+     *        when \ref has_offset() returns true; otherwise zero.
+     *
+     * \return The offset of the member inside its declaring class.
+     */
+    std::size_t get_offset() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns the plan of the nested object.
+     *
+     * For entries of kind \ref access_kind::object this is the plan of the property type,
+     * for \ref access_kind::wrapper the plan of the wrapped type and for \ref access_kind::pointer
+     * the plan of the type pointed to. For a \ref access_kind::sequential_container "sequential container",
+     * whose first template argument is an object, a pointer or a wrapper of an object (e.g. `std::vector<Foo>`),
+     * it is the plan of the items.
+     * Otherwise an invalid plan is returned.
+     *
+     * \remark The nested plan describes the declared type of the property;
+     *         for pointers and wrappers the object can be of a derived type at runtime.
+     *
+     * \return The plan of the nested object.
+     */
+    access_plan get_nested_plan() const;
+
+    /*!
+     * \brief Returns the address of the member object inside of the given object \p obj.
+     *
+     * This function can only be used, when \ref has_offset() returns true
+     * and \p obj is of the \ref property::get_declaring_type() "declaring type" of the property or derived from it.
+     * The value can then be read and written directly, without creating a \ref variant.
+     *
+     * \remark The address is also returned for \ref property::is_readonly() "read only" properties;
+     *         it is the responsibility of the caller not to write to it.
+     *
+     * \return The address of the member; or `nullptr` when the address cannot be retrieved.
+     */
+    void* get_member_address(const instance& obj) const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns an \ref instance of the member object inside of the given object \p obj.
+     *
+     * Same as \ref get_member_address(), but the member is returned as \ref instance of \ref get_value_type(),
+     * so its properties can be accessed without copying it.
+     *
+     * \return An instance of the member; or an invalid instance when the address cannot be retrieved.
+     */
+    instance get_member(const instance& obj) const RTTR_NOEXCEPT;
+
+private:
+    friend class detail::access_plan_private;
+
+    access_plan_entry(const property& prop, const detail::access_plan_graph* graph) RTTR_NOEXCEPT;
+
+private:
+    property                            m_property;
+    type                                m_value_type;
+    access_kind                         m_kind;
+    access_kind                         m_wrapped_kind;
+    bool                                m_has_offset;
+    std::size_t                         m_offset;
+    const detail::access_plan_node*     m_nested;
+    const detail::access_plan_graph*    m_graph;
+};
+
+/*!
+ * The \ref access_plan class contains the structure of a \ref type, compiled into a flat list of entries.
+ *
+ * Generic algorithms like serializers, hash functions or comparators usually walk over all properties
+ * of an object and have to find out for every value, whether it is an arithmetic value, a string,
+ * a container or a nested object. An \ref access_plan does this work only once per type:
+ * it contains one \ref access_plan_entry for every public property of the type, in the same order as \ref type::get_properties(),
+ * together with the \ref access_kind of its value and the plan of nested objects.
+ *
+ * Plans are cached per type; \ref get() compiles a plan only at the first call for a type.
+ * When properties are registered or types are unregistered (e.g. when a \ref library is unloaded),
+ * the cache is cleared and the plans are compiled again on next request.
+ *
+ * The item type of a container is only known for sequential containers of the standard library, see \ref access_plan_entry::get_nested_plan();
+ * otherwise the plan for the items can be retrieved with \ref get(), using the value type of the
+ * \ref variant_sequential_view or \ref variant_associative_view.
+ *
+ * Copying and Assignment
+ * ----------------------
+ * An \ref access_plan object is lightweight and can be copied by value. It keeps the compiled plan alive,
+ * even when the cache was cleared in the meantime; however, the contained properties are only valid
+ * as long as their type is registered.
+ *
+ * Typical Usage
+ * ----------------------
+ *
+ * \code{.cpp}
+ *   void write(const instance& obj, const access_plan& plan)
+ *   {
+ *      for (const auto& entry : plan.get_entries())
+ *      {
+ *          switch (entry.get_kind())
+ *          {
+ *              case access_kind::int32: write_int(entry.get_property().get_value(obj).get_value<int32_t>()); break;
+ *              case access_kind::object: write(entry.get_property().get_value(obj), entry.get_nested_plan()); break;
+ *              // ...
+ *          }
+ *      }
+ *   }
+ *
+ *   write(obj, access_plan::get(obj.get_derived_type()));
+ * \endcode
+ */
+class RTTR_API access_plan
+{
+public:
+    /*!
+     * \brief Constructs an invalid plan.
+     */
+    access_plan() RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns the plan for the \ref type::get_raw_type() "raw type" of \p t.
+     *
+     * The plan is compiled at the first call and cached afterwards.
+     * When \p t is not valid, an invalid plan is returned.
+     *
+     * \return The plan for the given type.
+     */
+    static access_plan get(const type& t);
+
+    /*!
+     * \brief Returns the access kind for values of type \p t.
+     *
+     * \return The access kind of the given type.
+     */
+    static access_kind get_kind(const type& t) RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns true if this plan is valid, otherwise false.
+     *
+     * \return True if this plan is valid, otherwise false.
+     */
+    bool is_valid() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Convenience function to check if this plan is valid or not.
+     *
+     * \return True if this plan is valid, otherwise false.
+     */
+    explicit operator bool() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns the type, for which this plan was compiled.
+     *
+     * \return The type of the plan.
+     */
+    type get_type() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns the entries of this plan, one for every public property of \ref get_type().
+     *
+     * \return A range of entries.
+     */
+    array_range<access_plan_entry> get_entries() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns the entry of the property with the given \p name.
+     *
+     * The names are looked up in a hash index, which is created when the plan is compiled;
+     * so the lookup does not depend on the number of properties.
+     *
+     * \return The entry; or `nullptr`, when there is no property with the given \p name in this plan.
+     */
+    const access_plan_entry* find_entry(string_view name) const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns a hash value of the structure described by this plan.
+     *
+     * The fingerprint is calculated from the type names, the property names, the access kinds and the property types
+     * of this plan and all nested plans. It can be stored together with serialized data, in order to detect
+     * that the data was written for a different layout of the type.
+     *
+     * \remark The fingerprint does not depend on the address of the registered types,
+     *         so it is the same for every run of the program, as long as the registration does not change.
+     *
+     * \return The fingerprint of the plan; or zero, when the plan is not valid.
+     */
+    std::uint64_t get_fingerprint() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns true if this plan is the same like the \p other.
+     *
+     * \return True if both plans are equal, otherwise false.
+     */
+    bool operator==(const access_plan& other) const RTTR_NOEXCEPT;
+
+    /*!
+     * Returns true if this plan is the not the same like the \p other.
+     *
+     * \return True if both plans are different, otherwise false.
+     */
+    bool operator!=(const access_plan& other) const RTTR_NOEXCEPT;
+
+private:
+    friend class access_plan_entry;
+    friend class detail::access_plan_private;
+
+    access_plan(std::shared_ptr<const detail::access_plan_graph> graph, const detail::access_plan_node* node) RTTR_NOEXCEPT;
+
+private:
+    std::shared_ptr<const detail::access_plan_graph>    m_graph;
+    const detail::access_plan_node*                     m_node;
+};
+
+} // end namespace rttr
+
+#endif // RTTR_ACCESS_PLAN_H_
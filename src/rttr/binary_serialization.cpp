@@ -0,0 +1,66 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/binary_serialization.h"
+#include "rttr/detail/serialization/binary_reader_p.h"
+#include "rttr/detail/serialization/binary_writer_p.h"
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool to_binary(instance obj, std::vector<std::uint8_t>& buffer)
+{
+    const instance object = detail::get_object_instance(obj);
+    if (!object.is_valid())
+        return false;
+
+    const auto size = buffer.size();
+    detail::binary_writer writer(buffer);
+    if (writer.write(object))
+        return true;
+
+    buffer.resize(size);
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool from_binary(const void* data, std::size_t size, instance obj)
+{
+    const instance object = detail::get_object_instance(obj);
+    if (!object.is_valid() || !data)
+        return false;
+
+    detail::binary_reader reader(static_cast<const std::uint8_t*>(data), size);
+    return reader.read(object);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
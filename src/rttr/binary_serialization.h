@@ -0,0 +1,82 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_BINARY_SERIALIZATION_H_
+#define RTTR_BINARY_SERIALIZATION_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include "rttr/type.h"
+#include "rttr/instance.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rttr
+{
+
+/*!
+ * \brief Serializes the object \p obj into a compact binary representation and appends it to \p buffer.
+ *
+ * The object is written with the \ref access_plan of its \ref instance::get_derived_type() "type":
+ * arithmetic values and enumerations are copied with their size in memory, strings are prefixed with their length,
+ * containers are written through their \ref variant_sequential_view "sequential" or \ref variant_associative_view "associative" view
+ * and nested objects with their own plan. Pointers and wrappers are followed; the pointed object is written with the plan
+ * of its declared type. Values of any other type are written with \ref variant::to_string().
+ *
+ * The data starts with a header, which contains the \ref access_plan::get_fingerprint() "fingerprint" of the plan,
+ * so \ref from_binary() can reject data written for a different layout without parsing it.
+ * Every object stores a table with the offsets of its values, so single values can be located without reading the whole object.
+ *
+ * Arithmetic values are written in the byte order of the host; data written on a host with a different byte order is rejected.
+ *
+ * \remark Pointer cycles are not detected; the object graph has to be a tree.
+ *
+ * \return True, when the object could be serialized; otherwise false and \p buffer is not modified.
+ */
+RTTR_API bool to_binary(instance obj, std::vector<std::uint8_t>& buffer);
+
+/*!
+ * \brief Deserializes the binary representation in \p data of \p size bytes into the object \p obj.
+ *
+ * The data has to be written by \ref to_binary() for an object of the same type with the same registered properties.
+ * Values are written back with \ref property::set_value(); trivially copyable member objects and strings are assigned directly.
+ * Containers are resized to the number of stored items, pointers and wrappers are only followed, when they already point to an object.
+ * Objects, which are stored as key or value of an associative container, are created with their default constructor;
+ * it has to be registered with the policy \ref policy::ctor::as_object.
+ * Read only properties are skipped.
+ *
+ * \return True, when the data could be read; otherwise false.
+ *         When the header or fingerprint does not match, \p obj is not modified;
+ *         when the data is truncated or corrupted, the values read so far are kept.
+ */
+RTTR_API bool from_binary(const void* data, std::size_t size, instance obj);
+
+} // end namespace rttr
+
+#endif // RTTR_BINARY_SERIALIZATION_H_
@@ -0,0 +1,301 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/binary_view.h"
+#include "rttr/detail/serialization/binary_reader_p.h"
+
+#include <cstring>
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_view::binary_view() RTTR_NOEXCEPT
+:   m_data(nullptr),
+    m_size(0)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_view::binary_view(const void* data, std::size_t size, const type& t)
+:   m_data(nullptr),
+    m_size(0)
+{
+    detail::binary_header header;
+    if (!data || size < sizeof(header))
+        return;
+
+    std::memcpy(&header, data, sizeof(header));
+    if (!detail::is_valid_binary_header(header))
+        return;
+
+    const auto plan = access_plan::get(t);
+    if (!plan.is_valid() || header.m_fingerprint != plan.get_fingerprint())
+        return;
+
+    *this = binary_view(plan, static_cast<const std::uint8_t*>(data) + sizeof(header), size - sizeof(header));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_view::binary_view(const access_plan& plan, const std::uint8_t* data, std::size_t size) RTTR_NOEXCEPT
+:   m_data(nullptr),
+    m_size(0)
+{
+    std::uint32_t object_size, count;
+    if (!plan.is_valid() || size < detail::binary_object_header_size)
+        return;
+
+    std::memcpy(&object_size, data, sizeof(object_size));
+    std::memcpy(&count, data + sizeof(object_size), sizeof(count));
+    if (object_size > size || count != plan.get_entries().size() ||
+        object_size < detail::binary_object_header_size + count * sizeof(std::uint32_t))
+    {
+        return;
+    }
+
+    m_plan = plan;
+    m_data = data;
+    m_size = object_size;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool binary_view::is_valid() const RTTR_NOEXCEPT
+{
+    return (m_data != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_view::operator bool() const RTTR_NOEXCEPT
+{
+    return (m_data != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type binary_view::get_type() const RTTR_NOEXCEPT
+{
+    return m_plan.get_type();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t binary_view::get_size() const RTTR_NOEXCEPT
+{
+    return m_size;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const std::uint8_t* binary_view::get_end() const RTTR_NOEXCEPT
+{
+    return (m_data + m_size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const std::uint8_t* binary_view::find_value(string_view name, const access_plan_entry*& entry) const RTTR_NOEXCEPT
+{
+    if (!m_data)
+        return nullptr;
+
+    const auto item = m_plan.find_entry(name);
+    if (!item)
+        return nullptr;
+
+    const auto entries = m_plan.get_entries();
+    const auto index = static_cast<std::size_t>(item - &*entries.begin());
+    const auto table_end = detail::binary_object_header_size + entries.size() * sizeof(std::uint32_t);
+    std::uint32_t offset;
+    std::memcpy(&offset, m_data + detail::binary_object_header_size + index * sizeof(std::uint32_t), sizeof(offset));
+    if (offset == 0 || offset < table_end || offset >= m_size)
+        return nullptr;
+
+    entry = item;
+    return (m_data + offset);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool binary_view::has_value(string_view name) const RTTR_NOEXCEPT
+{
+    const access_plan_entry* entry = nullptr;
+    return (find_value(name, entry) != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+string_view binary_view::get_string(string_view name) const RTTR_NOEXCEPT
+{
+    const access_plan_entry* entry = nullptr;
+    const auto pos = find_value(name, entry);
+    if (!pos || entry->get_kind() != access_kind::string || static_cast<std::size_t>(get_end() - pos) < sizeof(std::uint32_t))
+        return string_view();
+
+    std::uint32_t length;
+    std::memcpy(&length, pos, sizeof(length));
+    if (length > static_cast<std::size_t>(get_end() - pos) - sizeof(length))
+        return string_view();
+
+    return string_view(reinterpret_cast<const char*>(pos + sizeof(length)), length);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant binary_view::get_value(string_view name) const
+{
+    const access_plan_entry* entry = nullptr;
+    const auto pos = find_value(name, entry);
+    if (!pos)
+        return variant();
+
+    const auto kind = entry->get_kind();
+    const auto value_type = entry->get_value_type();
+    detail::binary_reader reader(pos, static_cast<std::size_t>(get_end() - pos));
+    variant value;
+    if (!detail::is_in_place_kind(kind))
+    {
+        if (!reader.read_value(value, kind, value_type))
+            return variant();
+    }
+    else if (kind != access_kind::pointer && kind != access_kind::wrapper)
+    {
+        value = detail::create_value(value_type);
+        if (!value.is_valid() || !reader.read_into(value, kind, value_type, entry->get_nested_plan()))
+            return variant();
+    }
+
+    return value;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_view binary_view::get_object(string_view name) const
+{
+    const access_plan_entry* entry = nullptr;
+    auto pos = find_value(name, entry);
+    if (!pos)
+        return binary_view();
+
+    const auto kind = entry->get_kind();
+    if (kind == access_kind::pointer || kind == access_kind::wrapper)
+    {
+        // a null pointer is written as flag without an object
+        if (*pos != 1)
+            return binary_view();
+
+        ++pos;
+    }
+    else if (kind != access_kind::object)
+    {
+        return binary_view();
+    }
+
+    return binary_view(entry->get_nested_plan(), pos, static_cast<std::size_t>(get_end() - pos));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t binary_view::get_item_count(string_view name) const RTTR_NOEXCEPT
+{
+    const access_plan_entry* entry = nullptr;
+    const auto pos = find_value(name, entry);
+    if (!pos || static_cast<std::size_t>(get_end() - pos) < sizeof(std::uint32_t) ||
+        (entry->get_kind() != access_kind::sequential_container && entry->get_kind() != access_kind::associative_container))
+    {
+        return 0;
+    }
+
+    std::uint32_t count;
+    std::memcpy(&count, pos, sizeof(count));
+    return count;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+binary_view binary_view::get_item(string_view name, std::size_t index) const
+{
+    const access_plan_entry* entry = nullptr;
+    auto pos = find_value(name, entry);
+    if (!pos || entry->get_kind() != access_kind::sequential_container || !entry->get_nested_plan().is_valid() ||
+        index >= get_item_count(name))
+    {
+        return binary_view();
+    }
+
+    const auto arg_list = entry->get_value_type().get_template_arguments();
+    const auto item_kind = access_plan::get_kind(*arg_list.begin());
+    const bool has_flag = (item_kind == access_kind::pointer || item_kind == access_kind::wrapper);
+    const auto end = get_end();
+    pos += sizeof(std::uint32_t);
+    for (std::size_t i = 0; pos < end; ++i)
+    {
+        // a null pointer is written as flag without an object
+        if (has_flag && *pos++ != 1)
+        {
+            if (i == index)
+                return binary_view();
+            else
+                continue;
+        }
+
+        if (i == index)
+            return binary_view(entry->get_nested_plan(), pos, static_cast<std::size_t>(end - pos));
+
+        std::uint32_t object_size;
+        if (static_cast<std::size_t>(end - pos) < sizeof(object_size))
+            break;
+
+        std::memcpy(&object_size, pos, sizeof(object_size));
+        if (object_size < sizeof(object_size) || object_size > static_cast<std::size_t>(end - pos))
+            break;
+
+        pos += object_size;
+    }
+
+    return binary_view();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool binary_view::read(instance obj) const
+{
+    const instance object = detail::get_object_instance(obj);
+    if (!m_data || !object.is_valid() || !object.get_derived_type().get_raw_type().is_derived_from(m_plan.get_type()))
+        return false;
+
+    detail::binary_reader reader(m_data, m_size);
+    return reader.read_object(object, m_plan);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
@@ -0,0 +1,192 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_BINARY_VIEW_H_
+#define RTTR_BINARY_VIEW_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include "rttr/type.h"
+#include "rttr/instance.h"
+#include "rttr/variant.h"
+#include "rttr/string_view.h"
+#include "rttr/access_plan.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace rttr
+{
+
+/*!
+ * The \ref binary_view class provides read-only access to an object, which was serialized with \ref to_binary(),
+ * without deserializing it.
+ *
+ * Every object in the binary format contains a table with the offsets of its values.
+ * A value is located by the name of its \ref property: the name is resolved to the index of the property
+ * in the \ref access_plan of the type, which is used to look up the offset of the value.
+ * Nothing else of the data is read; strings are returned as \ref string_view pointing into the data
+ * and nested objects as another \ref binary_view. Only the values, which are retrieved with \ref get_value()
+ * or \ref read(), are deserialized into real objects.
+ *
+ * Together with a \ref mapped_file, only the touched parts of a large file are loaded from disk.
+ *
+ * Typical Usage
+ * ----------------------
+ *
+ * \code{.cpp}
+ *   mapped_file file("scene.bin");
+ *   file.open();
+ *   binary_view scene(file.get_data(), file.get_size(), type::get<scene>());
+ *
+ *   string_view name = scene.get_string("name");
+ *   binary_view node = scene.get_item("nodes", 42);
+ *   variant position = node.get_value("position");   // only this object is created
+ * \endcode
+ *
+ * \remark The view does not copy the data; the data has to be valid as long as the view is used.
+ */
+class RTTR_API binary_view
+{
+public:
+    /*!
+     * \brief Constructs an invalid view.
+     */
+    binary_view() RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Constructs a view over the \p size bytes in \p data, which were written by \ref to_binary() for an object of type \p t.
+     *
+     * The view is only valid, when the header of the data is valid and its fingerprint matches the
+     * \ref access_plan::get_fingerprint() "fingerprint" of the access plan of \p t.
+     */
+    binary_view(const void* data, std::size_t size, const type& t);
+
+    /*!
+     * \brief Returns true if this view is valid, otherwise false.
+     *
+     * \return True if this view is valid, otherwise false.
+     */
+    bool is_valid() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Convenience function to check if this view is valid or not.
+     *
+     * \return True if this view is valid, otherwise false.
+     */
+    explicit operator bool() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns the type of the object in this view.
+     *
+     * \return The type of the object; or an invalid type, when the view is not valid.
+     */
+    type get_type() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns the size of the object in this view in bytes.
+     *
+     * \return The size of the object.
+     */
+    std::size_t get_size() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns true, when the object contains a value for the property with the given \p name.
+     *
+     * \return True, when the value was written; otherwise false.
+     */
+    bool has_value(string_view name) const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns the value of the `std::string` property with the given \p name.
+     *
+     * The returned \ref string_view points directly into the data, no copy is performed.
+     *
+     * \return The string; or an empty string, when there is no such string value.
+     */
+    string_view get_string(string_view name) const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Deserializes the value of the property with the given \p name.
+     *
+     * Arithmetic values, enumerations and strings are always returned.
+     * Objects and containers are only returned, when their type has a default constructor,
+     * which is registered with the policy \ref policy::ctor::as_object; the value of pointers and wrappers is never returned.
+     *
+     * \return The value; or an invalid variant, when the value could not be read.
+     */
+    variant get_value(string_view name) const;
+
+    /*!
+     * \brief Returns a view of the nested object of the property with the given \p name.
+     *
+     * The property has to be a object, or a pointer or wrapper of an object, see \ref access_plan_entry::get_nested_plan().
+     *
+     * \return The view of the nested object; or an invalid view, when there is no such object.
+     */
+    binary_view get_object(string_view name) const;
+
+    /*!
+     * \brief Returns the number of items of the container property with the given \p name.
+     *
+     * \return The number of items; or zero, when there is no such container.
+     */
+    std::size_t get_item_count(string_view name) const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns a view of the item at \p index of the sequential container property with the given \p name.
+     *
+     * The items of the container have to be objects, or pointers or wrappers of objects, see \ref access_plan_entry::get_nested_plan().
+     * The items before \p index are skipped by their size, without reading them.
+     *
+     * \return The view of the item; or an invalid view, when there is no such item.
+     */
+    binary_view get_item(string_view name, std::size_t index) const;
+
+    /*!
+     * \brief Deserializes the whole object of this view into \p obj, like \ref from_binary().
+     *
+     * \return True, when the data could be read; otherwise false.
+     */
+    bool read(instance obj) const;
+
+private:
+    binary_view(const access_plan& plan, const std::uint8_t* data, std::size_t size) RTTR_NOEXCEPT;
+
+    const std::uint8_t* find_value(string_view name, const access_plan_entry*& entry) const RTTR_NOEXCEPT;
+
+    const std::uint8_t* get_end() const RTTR_NOEXCEPT;
+
+private:
+    access_plan             m_plan;
+    const std::uint8_t*     m_data;
+    std::size_t             m_size;
+};
+
+} // end namespace rttr
+
+#endif // RTTR_BINARY_VIEW_H_
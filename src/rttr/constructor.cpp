@@ -71,6 +71,13 @@ bool constructor::is_valid() const RTTR_NOEXCEPT
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool constructor::can_invoke_at() const RTTR_NOEXCEPT
+{
+    return m_wrapper->can_invoke_at();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 constructor::operator bool() const RTTR_NOEXCEPT
 {
     return m_wrapper->is_valid();
@@ -174,7 +181,28 @@ variant constructor::invoke(argument arg1, argument arg2, argument arg3, argumen
 
 variant constructor::invoke_variadic(std::vector<argument> args) const
 {
-    return m_wrapper->invoke_variadic(args);
+    return invoke_variadic(args.data(), args.size());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant constructor::invoke_variadic(const argument* args, std::size_t arg_count) const
+{
+    return m_wrapper->invoke_variadic(args, arg_count);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant constructor::invoke_at(void* memory, std::vector<argument> args) const
+{
+    return invoke_at(memory, args.data(), args.size());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant constructor::invoke_at(void* memory, const argument* args, std::size_t arg_count) const
+{
+    return m_wrapper->invoke_at(memory, args, arg_count);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -103,6 +103,17 @@ class RTTR_API constructor
          */
         explicit operator bool() const RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Returns true if this constructor can construct an object in-place
+         *        via \ref invoke_at(), otherwise false.
+         *
+         * \remark Constructors registered via a factory function return their object by value,
+         *         so they cannot construct it in caller provided memory.
+         *
+         * \return True if \ref invoke_at() can be used with this constructor, otherwise false.
+         */
+        bool can_invoke_at() const RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns access level with which this constructor was
          *        \ref registration::class_<T>::constructor() "registered".
@@ -269,6 +280,56 @@ class RTTR_API constructor
          */
         variant invoke_variadic(std::vector<argument> args) const;
 
+        /*!
+         * \brief Invokes the constructor of type returned by \ref get_instantiated_type(),
+         *        using the \p arg_count arguments stored in the array \p args.
+         *
+         * In contrast to the overload with a `std::vector`, the arguments are not copied.
+         * So the caller can provide them e.g. as array on the stack, which avoids the allocation of an argument list.
+         *
+         * \remark The given argument type has to match **exactly** the type of the underling constructor parameter,
+         *         otherwise the constructor cannot be invoked and an invalid \ref variant object (see \ref variant::is_valid)
+         *         will be returned.
+         *
+         * \see get_parameter_infos()
+         *
+         * \return An instance of the type \ref get_instantiated_type().
+         */
+        variant invoke_variadic(const argument* args, std::size_t arg_count) const;
+
+        /*!
+         * \brief Constructs an instance of the type returned by \ref get_instantiated_type()
+         *        inside the already allocated storage \p memory, using the given arguments \p args.
+         *
+         * The storage has to be at least \ref type::get_sizeof() bytes large and has to be aligned
+         * to \ref type::get_alignof(); for storage which is not suitable aligned, no object is constructed.
+         * Because the storage is owned by the caller, the returned object must not be deleted;
+         * use \ref destructor::invoke_at() to destroy it again.
+         * This makes it possible to combine the constructor with any custom allocator or object pool.
+         *
+         * \remark The returned variant will always contain a pointer to the constructed object,
+         *         regardless of the registered \ref policy::ctor. Constructors registered via a factory function
+         *         cannot construct an object in-place; for those an invalid \ref variant will be returned.
+         *         Use \ref can_invoke_at() to check this up front.
+         *         Registered \ref default_arguments will be honored.
+         *
+         * \see get_parameter_infos(), can_invoke_at()
+         *
+         * \return A pointer to the constructed object, or an invalid \ref variant when the object could not be constructed.
+         */
+        variant invoke_at(void* memory, std::vector<argument> args = std::vector<argument>()) const;
+
+        /*!
+         * \brief Constructs an instance of the type returned by \ref get_instantiated_type()
+         *        inside the already allocated storage \p memory, using the \p arg_count arguments
+         *        stored in the array \p args.
+         *
+         * \see invoke_at(void*, std::vector<argument>) const
+         *
+         * \return A pointer to the constructed object, or an invalid \ref variant when the object could not be constructed.
+         */
+        variant invoke_at(void* memory, const argument* args, std::size_t arg_count) const;
+
         /*!
          * \brief Returns true if this constructor is the same like the \p other.
          *
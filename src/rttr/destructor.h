@@ -112,6 +112,19 @@ class RTTR_API destructor
          */
         bool invoke(variant& obj) const RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Runs the destructor of the object contained in the variant \p obj, without releasing its storage.
+         *
+         * Use this method to destroy objects which were created with \ref constructor::invoke_at();
+         * the storage itself is owned by the caller and can be reused afterwards.
+         *
+         * \remark When the \p obj could be destroyed the given \p obj is invalid after calling this method;
+         *         Otherwise it is still valid.
+         *
+         * \return True if the destructor of the object could be invoked, otherwise false.
+         */
+        bool invoke_at(variant& obj) const RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns true if this destructor is the same like the \p other.
          *
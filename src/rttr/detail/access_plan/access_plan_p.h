@@ -0,0 +1,95 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_ACCESS_PLAN_P_H_
+#define RTTR_ACCESS_PLAN_P_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include "rttr/access_plan.h"
+#include "rttr/string_view.h"
+#include "rttr/detail/misc/flat_map.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * The compiled plan of one type.
+ */
+struct access_plan_node
+{
+    access_plan_node(const type& t) : m_type(t), m_fingerprint(0) {}
+
+    type                                    m_type;
+    std::vector<access_plan_entry>          m_entries;
+    flat_map<string_view, std::size_t>      m_entry_index;
+    std::uint64_t                           m_fingerprint;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Owns the plans of all types, which are reachable from the type a plan was compiled for.
+ * The entries refer to the plans of nested objects only by a raw pointer,
+ * so recursive types, e.g. a class with a pointer to itself, do not create ownership cycles.
+ */
+struct access_plan_graph : std::enable_shared_from_this<access_plan_graph>
+{
+    std::vector<std::unique_ptr<access_plan_node>> m_nodes;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+class RTTR_LOCAL access_plan_private
+{
+public:
+    static access_plan get(const type& t);
+
+    static access_plan compile(const type& t);
+
+    static void* get_member_address(const access_plan_entry& entry, const instance& obj) RTTR_NOEXCEPT;
+
+    static instance get_member(const access_plan_entry& entry, const instance& obj) RTTR_NOEXCEPT;
+
+private:
+    static type get_nested_type(const access_plan_entry& entry);
+
+    static type get_object_type(const type& t);
+
+    static std::uint64_t get_fingerprint(const access_plan_node* node);
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_ACCESS_PLAN_P_H_
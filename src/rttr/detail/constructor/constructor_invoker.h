@@ -32,6 +32,9 @@
 #include "rttr/detail/misc/utility.h"
 #include "rttr/detail/policies/ctor_policies.h"
 
+#include <cstdint>
+#include <new>
+
 namespace rttr
 {
 namespace detail
@@ -41,6 +44,8 @@ struct ctor_type { };
 
 struct ctor_func_type { };
 
+struct ctor_in_place_type { };
+
 /////////////////////////////////////////////////////////////////////////////////////////
 
 template<typename Ctor_Type, typename Policy, typename Accessor, typename Arg_Indexer>
@@ -100,6 +105,30 @@ struct constructor_invoker<ctor_type, as_std_shared_ptr, type_list<Class_Type, C
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+/*!
+ * Constructs an object of type \p Class_Type in the given, suitable aligned, memory via placement new.
+ * The created object is always returned as raw pointer, independent of the registered constructor policy.
+ * When \p memory is not aligned for \p Class_Type, no object is constructed.
+ */
+template<typename Class_Type, typename...Ctor_Args, std::size_t... Arg_Count>
+struct constructor_invoker<ctor_in_place_type, as_raw_pointer, type_list<Class_Type, Ctor_Args...>, index_sequence<Arg_Count...>>
+{
+    using return_type = add_pointer_t<Class_Type>;
+
+    static RTTR_INLINE variant invoke(void* memory, const argument* arg_list)
+    {
+        if (reinterpret_cast<std::uintptr_t>(memory) % alignof(Class_Type) != 0)
+            return variant();
+
+        if (check_all_true(arg_list[Arg_Count].template is_type<Ctor_Args>()...))
+            return variant(::new (memory) Class_Type(arg_list[Arg_Count].template get_value<Ctor_Args>()...));
+        else
+            return variant();
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 } // end namespace detail
 } // end namespace rttr
 
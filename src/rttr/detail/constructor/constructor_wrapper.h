@@ -77,6 +77,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
 :   public constructor_wrapper_base, public metadata_handler<Metadata_Count>
 {
     using invoker_class = constructor_invoker<ctor_type, Policy, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
+    using in_place_invoker_class = constructor_invoker<ctor_in_place_type, as_raw_pointer, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
     using instanciated_type = typename invoker_class::return_type;
 
     public:
@@ -89,6 +90,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
         }
 
         bool is_valid()                     const RTTR_NOEXCEPT { return true; }
+        bool can_invoke_at()                const RTTR_NOEXCEPT { return true; }
         access_levels get_access_level()    const RTTR_NOEXCEPT { return Acc_Level; }
         type get_instantiated_type()        const RTTR_NOEXCEPT { return type::get<instanciated_type>(); }
         type get_declaring_type()           const RTTR_NOEXCEPT { return type::get<typename raw_type<Class_Type>::type>(); }
@@ -154,17 +156,25 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
         }
 
         template<std::size_t ...I>
-        static RTTR_INLINE variant invoke_variadic_impl(const std::vector<argument>& arg_list, index_sequence<I...>)
+        static RTTR_INLINE variant invoke_variadic_impl(const argument* arg_list, std::size_t arg_count, index_sequence<I...>)
         {
-            if (arg_list.size() == sizeof...(I))
+            if (arg_count == sizeof...(I))
                 return invoker_class::invoke(arg_list[I]...);
             else
                 return variant();
         }
 
-        variant invoke_variadic(std::vector<argument>& arg_list) const
+        variant invoke_variadic(const argument* arg_list, std::size_t arg_count) const
         {
-            return invoke_variadic_impl(arg_list, make_index_sequence<sizeof...(Ctor_Args)>());
+            return invoke_variadic_impl(arg_list, arg_count, make_index_sequence<sizeof...(Ctor_Args)>());
+        }
+
+        variant invoke_at(void* memory, const argument* arg_list, std::size_t arg_count) const
+        {
+            if (memory && arg_count == sizeof...(Ctor_Args))
+                return in_place_invoker_class::invoke(memory, arg_list);
+            else
+                return variant();
         }
 
         void visit(visitor& visitor, const constructor& ctor) const RTTR_NOEXCEPT
@@ -241,9 +251,9 @@ class constructor_wrapper<Class_Type, return_func, Acc_Level, Policy,
         {
             return method_accessor<F, Policy>::invoke(m_creator_func, instance(), arg1, arg2, arg3, arg4, arg5, arg6);
         }
-        variant invoke_variadic(std::vector<argument>& args) const
+        variant invoke_variadic(const argument* args, std::size_t arg_count) const
         {
-            return method_accessor<F, Policy>::invoke_variadic(m_creator_func, instance(), args);
+            return method_accessor<F, Policy>::invoke_variadic(m_creator_func, instance(), args, arg_count);
         }
 
         void visit(visitor& visitor, const constructor& ctor) const RTTR_NOEXCEPT
@@ -269,6 +279,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
 :   public constructor_wrapper_base, public metadata_handler<Metadata_Count>
 {
     using invoker_class = constructor_invoker<ctor_type, Policy, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
+    using in_place_invoker_class = constructor_invoker<ctor_in_place_type, as_raw_pointer, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
     using instanciated_type = typename invoker_class::return_type;
 
     public:
@@ -280,6 +291,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
         }
 
         bool is_valid()                     const RTTR_NOEXCEPT { return true; }
+        bool can_invoke_at()                const RTTR_NOEXCEPT { return true; }
         access_levels get_access_level()    const RTTR_NOEXCEPT { return Acc_Level; }
         type get_instantiated_type()        const RTTR_NOEXCEPT { return type::get<instanciated_type>(); }
         type get_declaring_type()           const RTTR_NOEXCEPT { return type::get<typename raw_type<Class_Type>::type>(); }
@@ -343,17 +355,25 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy,
         }
 
         template<std::size_t ...I>
-        static RTTR_INLINE variant invoke_variadic_impl(const std::vector<argument>& arg_list, index_sequence<I...>)
+        static RTTR_INLINE variant invoke_variadic_impl(const argument* arg_list, std::size_t arg_count, index_sequence<I...>)
         {
-            if (arg_list.size() == sizeof...(I))
+            if (arg_count == sizeof...(I))
                 return invoker_class::invoke(arg_list[I]...);
             else
                 return variant();
         }
 
-        variant invoke_variadic(std::vector<argument>& arg_list) const
+        variant invoke_variadic(const argument* arg_list, std::size_t arg_count) const
         {
-            return invoke_variadic_impl(arg_list, make_index_sequence<sizeof...(Ctor_Args)>());
+            return invoke_variadic_impl(arg_list, arg_count, make_index_sequence<sizeof...(Ctor_Args)>());
+        }
+
+        variant invoke_at(void* memory, const argument* arg_list, std::size_t arg_count) const
+        {
+            if (memory && arg_count == sizeof...(Ctor_Args))
+                return in_place_invoker_class::invoke(memory, arg_list);
+            else
+                return variant();
         }
 
         void visit(visitor& visitor, const constructor& ctor) const RTTR_NOEXCEPT
@@ -423,9 +443,9 @@ class constructor_wrapper<Class_Type, return_func, Acc_Level, Policy,
         {
             return method_accessor<F, Policy>::invoke(m_creator_func, instance(), arg1, arg2, arg3, arg4, arg5, arg6);
         }
-        variant invoke_variadic(std::vector<argument>& args) const
+        variant invoke_variadic(const argument* args, std::size_t arg_count) const
         {
-            return method_accessor<F, Policy>::invoke_variadic(m_creator_func, instance(), args);
+            return method_accessor<F, Policy>::invoke_variadic(m_creator_func, instance(), args, arg_count);
         }
 
         void visit(visitor& visitor, const constructor& ctor) const RTTR_NOEXCEPT
@@ -103,6 +103,13 @@ bool constructor_wrapper_base::is_valid() const RTTR_NOEXCEPT
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool constructor_wrapper_base::can_invoke_at() const RTTR_NOEXCEPT
+{
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 type constructor_wrapper_base::get_declaring_type() const RTTR_NOEXCEPT
 {
     return get_invalid_type();
@@ -203,7 +210,14 @@ variant constructor_wrapper_base::invoke(argument& arg1, argument& arg2, argumen
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-variant constructor_wrapper_base::invoke_variadic(std::vector<argument>& args) const
+variant constructor_wrapper_base::invoke_variadic(const argument* args, std::size_t arg_count) const
+{
+    return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant constructor_wrapper_base::invoke_at(void* memory, const argument* args, std::size_t arg_count) const
 {
     return variant();
 }
@@ -62,6 +62,7 @@ class RTTR_API constructor_wrapper_base
         string_view get_signature() const RTTR_NOEXCEPT;
 
         virtual bool is_valid() const RTTR_NOEXCEPT;
+        virtual bool can_invoke_at() const RTTR_NOEXCEPT;
         virtual type get_declaring_type() const RTTR_NOEXCEPT;
         virtual access_levels get_access_level() const RTTR_NOEXCEPT;
         virtual type get_instantiated_type() const RTTR_NOEXCEPT;
@@ -80,7 +81,8 @@ class RTTR_API constructor_wrapper_base
         virtual variant invoke(argument& arg1, argument& arg2, argument& arg3, argument& arg4,
                                argument& arg5, argument& arg6) const;
 
-        virtual variant invoke_variadic(std::vector<argument>& args) const;
+        virtual variant invoke_variadic(const argument* args, std::size_t arg_count) const;
+        virtual variant invoke_at(void* memory, const argument* args, std::size_t arg_count) const;
 
         virtual void visit(visitor& visitor, const constructor& ctor) const RTTR_NOEXCEPT;
     protected:
@@ -44,6 +44,7 @@
 #include "rttr/detail/visitor/visitor_iterator.h"
 #include "rttr/detail/visitor/constructor_visitor_invoker.h"
 
+#include <array>
 #include <vector>
 #include <utility>
 #include <type_traits>
@@ -64,6 +65,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy, Metadata_Co
 :   public constructor_wrapper_base, public metadata_handler<Metadata_Count>
 {
         using invoker_class = constructor_invoker<ctor_type, Policy, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
+        using in_place_invoker_class = constructor_invoker<ctor_in_place_type, as_raw_pointer, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
         using instanciated_type = typename invoker_class::return_type;
         using invoke_with_defaults = invoke_defaults_helper<invoker_class, type_list<Ctor_Args...>>;
 
@@ -80,6 +82,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy, Metadata_Co
         }
 
         bool is_valid()                  const RTTR_NOEXCEPT { return true; }
+        bool can_invoke_at()             const RTTR_NOEXCEPT { return true; }
         type get_instantiated_type()     const RTTR_NOEXCEPT { return type::get<instanciated_type>(); }
         type get_declaring_type()        const RTTR_NOEXCEPT { return type::get<typename raw_type<Class_Type>::type>(); }
         access_levels get_access_level() const RTTR_NOEXCEPT { return Acc_Level; }
@@ -127,14 +130,35 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy, Metadata_Co
             return invoke_with_defaults::invoke(m_def_args.m_args, arg1, arg2, arg3, arg4, arg5, arg6);
         }
 
-        variant invoke_variadic(std::vector<argument>& args) const
+        variant invoke_variadic(const argument* args, std::size_t arg_count) const
         {
-            if (args.size() <= sizeof...(Ctor_Args))
-                return invoke_variadic_helper<invoke_with_defaults, index_sequence_for<Ctor_Args...>>::invoke(args, m_def_args.m_args);
+            if (arg_count <= sizeof...(Ctor_Args))
+                return invoke_variadic_helper<invoke_with_defaults, index_sequence_for<Ctor_Args...>>::invoke(args, arg_count, m_def_args.m_args);
             else
                 return variant();
         }
 
+        template<std::size_t... Def_Idx>
+        RTTR_INLINE std::array<argument, sizeof...(Def_Args)> get_default_arg_list(index_sequence<Def_Idx...>) const
+        {
+            return {{argument(std::get<Def_Idx>(m_def_args.m_args))...}};
+        }
+
+        variant invoke_at(void* memory, const argument* args, std::size_t arg_count) const
+        {
+            // the default arguments always belong to the right most parameters
+            static RTTR_CONSTEXPR_OR_CONST std::size_t first_def_index = sizeof...(Ctor_Args) - sizeof...(Def_Args);
+            if (!memory || arg_count > sizeof...(Ctor_Args) || arg_count < first_def_index)
+                return variant();
+
+            const std::array<argument, sizeof...(Def_Args)> def_list = get_default_arg_list(index_sequence_for<Def_Args...>());
+            std::array<argument, sizeof...(Ctor_Args)> arg_list;
+            for (std::size_t i = 0; i < arg_list.size(); ++i)
+                arg_list[i] = (i < arg_count) ? args[i] : def_list[i - first_def_index];
+
+            return in_place_invoker_class::invoke(memory, arg_list.data());
+        }
+
         void visit(visitor& visitor, const constructor& ctor) const RTTR_NOEXCEPT
         {
             auto obj = make_ctor_info<Class_Type, Policy, Ctor_Args...>(ctor);
@@ -213,10 +237,10 @@ class constructor_wrapper<Class_Type, return_func, Acc_Level, Policy,
         {
             return invoke_with_defaults::invoke(m_creator_func, instance(), m_def_args.m_args, arg1, arg2, arg3, arg4, arg5, arg6);
         }
-        variant invoke_variadic(std::vector<argument>& args) const
+        variant invoke_variadic(const argument* args, std::size_t arg_count) const
         {
-            if (args.size() <= function_traits<F>::arg_count)
-                return invoke_variadic_helper<invoke_with_defaults, arg_index_sequence>::invoke(args, m_creator_func, instance(), m_def_args.m_args);
+            if (arg_count <= function_traits<F>::arg_count)
+                return invoke_variadic_helper<invoke_with_defaults, arg_index_sequence>::invoke(args, arg_count, m_creator_func, instance(), m_def_args.m_args);
             else
                 return variant();
         }
@@ -243,6 +267,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy, Metadata_Co
 :   public constructor_wrapper_base, public metadata_handler<Metadata_Count>
 {
         using invoker_class = constructor_invoker<ctor_type, Policy, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
+        using in_place_invoker_class = constructor_invoker<ctor_in_place_type, as_raw_pointer, type_list<Class_Type, Ctor_Args...>, index_sequence_for<Ctor_Args...>>;
         using instanciated_type = typename invoker_class::return_type;
         using invoke_with_defaults = invoke_defaults_helper<invoker_class, type_list<Ctor_Args...>>;
 
@@ -257,6 +282,7 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy, Metadata_Co
         }
 
         bool is_valid()                  const RTTR_NOEXCEPT { return true; }
+        bool can_invoke_at()             const RTTR_NOEXCEPT { return true; }
         type get_instantiated_type()     const RTTR_NOEXCEPT { return type::get<instanciated_type>(); }
         type get_declaring_type()        const RTTR_NOEXCEPT { return type::get<typename raw_type<Class_Type>::type>(); }
         access_levels get_access_level() const RTTR_NOEXCEPT { return Acc_Level; }
@@ -303,14 +329,35 @@ class constructor_wrapper<Class_Type, class_ctor, Acc_Level, Policy, Metadata_Co
             return invoke_with_defaults::invoke(m_def_args.m_args, arg1, arg2, arg3, arg4, arg5, arg6);
         }
 
-        variant invoke_variadic(std::vector<argument>& args) const
+        variant invoke_variadic(const argument* args, std::size_t arg_count) const
         {
-            if (args.size() <= sizeof...(Ctor_Args))
-                return invoke_variadic_helper<invoke_with_defaults, index_sequence_for<Ctor_Args...>>::invoke(args, m_def_args.m_args);
+            if (arg_count <= sizeof...(Ctor_Args))
+                return invoke_variadic_helper<invoke_with_defaults, index_sequence_for<Ctor_Args...>>::invoke(args, arg_count, m_def_args.m_args);
             else
                 return variant();
         }
 
+        template<std::size_t... Def_Idx>
+        RTTR_INLINE std::array<argument, sizeof...(Def_Args)> get_default_arg_list(index_sequence<Def_Idx...>) const
+        {
+            return {{argument(std::get<Def_Idx>(m_def_args.m_args))...}};
+        }
+
+        variant invoke_at(void* memory, const argument* args, std::size_t arg_count) const
+        {
+            // the default arguments always belong to the right most parameters
+            static RTTR_CONSTEXPR_OR_CONST std::size_t first_def_index = sizeof...(Ctor_Args) - sizeof...(Def_Args);
+            if (!memory || arg_count > sizeof...(Ctor_Args) || arg_count < first_def_index)
+                return variant();
+
+            const std::array<argument, sizeof...(Def_Args)> def_list = get_default_arg_list(index_sequence_for<Def_Args...>());
+            std::array<argument, sizeof...(Ctor_Args)> arg_list;
+            for (std::size_t i = 0; i < arg_list.size(); ++i)
+                arg_list[i] = (i < arg_count) ? args[i] : def_list[i - first_def_index];
+
+            return in_place_invoker_class::invoke(memory, arg_list.data());
+        }
+
         void visit(visitor& visitor, const constructor& ctor) const RTTR_NOEXCEPT
         {
             auto obj = make_ctor_info<Class_Type, Policy, Ctor_Args...>(ctor);
@@ -384,10 +431,10 @@ class constructor_wrapper<Class_Type, return_func, Acc_Level, Policy,
         {
             return invoke_with_defaults::invoke(m_creator_func, instance(), m_def_args.m_args, arg1, arg2, arg3, arg4, arg5, arg6);
         }
-        variant invoke_variadic(std::vector<argument>& args) const
+        variant invoke_variadic(const argument* args, std::size_t arg_count) const
         {
-            if (args.size() <= function_traits<F>::arg_count)
-                return invoke_variadic_helper<invoke_with_defaults, arg_index_sequence>::invoke(args, m_creator_func, instance(), m_def_args.m_args);
+            if (arg_count <= function_traits<F>::arg_count)
+                return invoke_variadic_helper<invoke_with_defaults, arg_index_sequence>::invoke(args, arg_count, m_creator_func, instance(), m_def_args.m_args);
             else
                 return variant();
         }
@@ -148,19 +148,19 @@ struct invoke_variadic_helper;
 
 /*!
  * Generic class to call the static method 'Invoker_Class::invoke',
- * with the correct argument list 'size()'; this can only be decided at runtime.
+ * with the correct argument count 'arg_count'; this can only be decided at runtime.
  */
 template<typename Invoker_Class, std::size_t... Arg_Idx>
 struct invoke_variadic_helper<Invoker_Class, index_sequence<Arg_Idx...>>
 {
     template<typename... Args>
-    static RTTR_INLINE variant invoke(std::vector<argument>& arg_list, Args&&...args)
+    static RTTR_INLINE variant invoke(const argument* arg_list, std::size_t arg_count, Args&&...args)
     {
         static RTTR_CONSTEXPR_OR_CONST std::size_t Arg_Count = sizeof...(Arg_Idx);
-        if (arg_list.size() == Arg_Count)
+        if (arg_count == Arg_Count)
             return Invoker_Class::invoke(args..., arg_list[Arg_Idx]...);
         else
-            return invoke_variadic_helper<Invoker_Class, make_index_sequence<Arg_Count - 1>>::invoke(arg_list, args...);
+            return invoke_variadic_helper<Invoker_Class, make_index_sequence<Arg_Count - 1>>::invoke(arg_list, arg_count, args...);
     }
 };
 
@@ -168,7 +168,7 @@ template<typename Invoker_Class>
 struct invoke_variadic_helper<Invoker_Class, index_sequence<>>
 {
     template<typename...Args>
-    static RTTR_INLINE variant invoke(std::vector<argument>& arg_list, Args&&...args)
+    static RTTR_INLINE variant invoke(const argument* arg_list, std::size_t arg_count, Args&&...args)
     {
         return Invoker_Class::invoke(args...);
     }
@@ -63,6 +63,21 @@ class destructor_wrapper : public destructor_wrapper_base
                 return false;
             }
         }
+
+        bool invoke_at(variant& obj) const RTTR_NOEXCEPT
+        {
+            if (obj.is_type<ClassType*>())
+            {
+                // the storage is owned by the caller, so we only run the destructor
+                obj.get_value<ClassType*>()->~ClassType();
+                obj = variant();
+                return true;
+            }
+            else
+            {
+                return false;
+            }
+        }
 };
 
 } // end namespace detail
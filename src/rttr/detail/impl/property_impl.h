@@ -0,0 +1,92 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_PROPERTY_IMPL_H_
+#define RTTR_PROPERTY_IMPL_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/property/typed_property_thunk.h"
+#include "rttr/detail/type/type_name.h"
+
+#include <cstddef>
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename C, typename T>
+RTTR_INLINE typed_accessor<C, T> property::get_accessor() const RTTR_NOEXCEPT
+{
+    using getter_func = typename typed_accessor<C, T>::getter_func;
+    using setter_func = typename typed_accessor<C, T>::setter_func;
+    const detail::typed_property_thunk thunk = get_typed_thunk(detail::get_type_name<getter_func>());
+    if (thunk.m_getter_thunk)
+        return typed_accessor<C, T>(reinterpret_cast<getter_func>(thunk.m_getter_thunk),
+                                    reinterpret_cast<setter_func>(thunk.m_setter_thunk),
+                                    thunk.m_getter, thunk.m_setter);
+    else
+        return typed_accessor<C, T>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename C, typename T>
+RTTR_INLINE bool property::get_values(const C* objects, std::size_t stride, std::size_t count, T* output) const
+{
+    using getter_func = typename typed_accessor<C, T>::getter_func;
+    using get_values_func = void(*)(const void*, const char*, std::size_t, std::size_t, T*);
+    const detail::typed_property_thunk thunk = get_typed_thunk(detail::get_type_name<getter_func>());
+    if (!thunk.m_get_values_thunk)
+        return false;
+
+    reinterpret_cast<get_values_func>(thunk.m_get_values_thunk)(thunk.m_getter, reinterpret_cast<const char*>(objects),
+                                                                 stride, count, output);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename C, typename T>
+RTTR_INLINE bool property::set_values(C* objects, std::size_t stride, std::size_t count, const T* input) const
+{
+    using getter_func = typename typed_accessor<C, T>::getter_func;
+    using set_values_func = void(*)(const void*, char*, std::size_t, std::size_t, const T*);
+    const detail::typed_property_thunk thunk = get_typed_thunk(detail::get_type_name<getter_func>());
+    if (!thunk.m_set_values_thunk)
+        return false;
+
+    reinterpret_cast<set_values_func>(thunk.m_set_values_thunk)(thunk.m_setter, reinterpret_cast<char*>(objects),
+                                                                 stride, count, input);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
+
+#endif // RTTR_PROPERTY_IMPL_H_
@@ -0,0 +1,123 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_TYPED_ACCESSOR_IMPL_H_
+#define RTTR_TYPED_ACCESSOR_IMPL_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename C, typename T>
+RTTR_INLINE typed_accessor<C, T>::typed_accessor() RTTR_NOEXCEPT
+:   m_getter_thunk(nullptr),
+    m_setter_thunk(nullptr),
+    m_getter(nullptr),
+    m_setter(nullptr)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename C, typename T>
+RTTR_INLINE typed_accessor<C, T>::typed_accessor(getter_func getter_thunk, setter_func setter_thunk,
+                                                 const void* getter, const void* setter) RTTR_NOEXCEPT
+:   m_getter_thunk(getter_thunk),
+    m_setter_thunk(setter_thunk),
+    m_getter(getter),
+    m_setter(setter)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename C, typename T>
+RTTR_INLINE bool typed_accessor<C, T>::is_valid() const RTTR_NOEXCEPT
+{
+    return (m_getter_thunk != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename C, typename T>
+RTTR_INLINE typed_accessor<C, T>::operator bool() const RTTR_NOEXCEPT
+{
+    return (m_getter_thunk != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename C, typename T>
+RTTR_INLINE bool typed_accessor<C, T>::is_readonly() const RTTR_NOEXCEPT
+{
+    return (m_setter_thunk == nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename C, typename T>
+RTTR_INLINE T typed_accessor<C, T>::get(const C& object) const
+{
+    return m_getter_thunk(m_getter, object);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename C, typename T>
+RTTR_INLINE bool typed_accessor<C, T>::set(C& object, const value_type& value) const
+{
+    if (!m_setter_thunk)
+        return false;
+
+    m_setter_thunk(m_setter, object, value);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename C, typename T>
+RTTR_INLINE bool typed_accessor<C, T>::operator==(const typed_accessor& other) const RTTR_NOEXCEPT
+{
+    return (m_getter_thunk == other.m_getter_thunk && m_getter == other.m_getter);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename C, typename T>
+RTTR_INLINE bool typed_accessor<C, T>::operator!=(const typed_accessor& other) const RTTR_NOEXCEPT
+{
+    return !(*this == other);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
+
+#endif // RTTR_TYPED_ACCESSOR_IMPL_H_
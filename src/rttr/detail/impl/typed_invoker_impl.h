@@ -0,0 +1,108 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_TYPED_INVOKER_IMPL_H_
+#define RTTR_TYPED_INVOKER_IMPL_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <utility>
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename R, typename... Args>
+RTTR_INLINE typed_invoker<R(Args...)>::typed_invoker() RTTR_NOEXCEPT
+:   m_thunk(nullptr),
+    m_func(nullptr)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename R, typename... Args>
+RTTR_INLINE typed_invoker<R(Args...)>::typed_invoker(thunk_func thunk, const void* func) RTTR_NOEXCEPT
+:   m_thunk(thunk),
+    m_func(func)
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename R, typename... Args>
+RTTR_INLINE bool typed_invoker<R(Args...)>::is_valid() const RTTR_NOEXCEPT
+{
+    return (m_thunk != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename R, typename... Args>
+RTTR_INLINE typed_invoker<R(Args...)>::operator bool() const RTTR_NOEXCEPT
+{
+    return (m_thunk != nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename R, typename... Args>
+RTTR_INLINE R typed_invoker<R(Args...)>::invoke(Args... args) const
+{
+    return m_thunk(m_func, std::forward<Args>(args)...);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename R, typename... Args>
+RTTR_INLINE R typed_invoker<R(Args...)>::operator()(Args... args) const
+{
+    return m_thunk(m_func, std::forward<Args>(args)...);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename R, typename... Args>
+RTTR_INLINE bool typed_invoker<R(Args...)>::operator==(const typed_invoker& other) const RTTR_NOEXCEPT
+{
+    return (m_thunk == other.m_thunk && m_func == other.m_func);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename R, typename... Args>
+RTTR_INLINE bool typed_invoker<R(Args...)>::operator!=(const typed_invoker& other) const RTTR_NOEXCEPT
+{
+    return !(*this == other);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
+
+#endif // RTTR_TYPED_INVOKER_IMPL_H_
@@ -0,0 +1,118 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_MAPPED_FILE_P_H_
+#define RTTR_MAPPED_FILE_P_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/string_view.h"
+
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+    #include <windows.h>
+#endif
+
+#include <cstdint>
+#include <string>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * This class contains the private implementation of the \ref mapped_file class.
+ */
+class RTTR_LOCAL mapped_file_private
+{
+public:
+    mapped_file_private(string_view file_name)
+    :   m_file_name(file_name),
+        m_data(nullptr),
+        m_size(0),
+        m_is_open(false)
+    {
+    }
+
+    ~mapped_file_private()
+    {
+        close();
+    }
+
+    bool open()
+    {
+        if (m_is_open)
+            return true;
+
+        m_is_open = open_native();
+        if (m_is_open)
+            m_error_string.clear();
+
+        return m_is_open;
+    }
+
+    bool close()
+    {
+        if (!m_is_open)
+            return false;
+
+        if (!close_native())
+            return false;
+
+        m_data = nullptr;
+        m_size = 0;
+        m_is_open = false;
+        m_error_string.clear();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////
+
+    bool is_open() const RTTR_NOEXCEPT { return m_is_open; }
+    const std::uint8_t* get_data() const RTTR_NOEXCEPT { return m_data; }
+    std::size_t get_size() const RTTR_NOEXCEPT { return m_size; }
+    string_view get_file_name() const RTTR_NOEXCEPT { return m_file_name; }
+    string_view get_error_string() const RTTR_NOEXCEPT { return m_error_string; }
+
+private:
+    bool open_native();
+    bool close_native();
+
+private:
+    std::string             m_file_name;
+    std::string             m_error_string;
+    const std::uint8_t*     m_data;
+    std::size_t             m_size;
+    bool                    m_is_open;
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+    HANDLE                  m_mapping = nullptr;
+#endif
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_MAPPED_FILE_P_H_
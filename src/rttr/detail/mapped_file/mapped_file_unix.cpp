@@ -0,0 +1,115 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#if RTTR_PLATFORM != RTTR_PLATFORM_WINDOWS
+
+#include "rttr/detail/mapped_file/mapped_file_p.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+
+std::string get_error()
+{
+    return std::strerror(errno);
+}
+
+} // end namespace anonymous
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool mapped_file_private::open_native()
+{
+    const int fd = ::open(m_file_name.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        m_error_string = "Cannot open file '" + m_file_name + "': " + get_error();
+        return false;
+    }
+
+    struct stat file_info;
+    if (::fstat(fd, &file_info) == -1)
+    {
+        m_error_string = "Cannot read the size of file '" + m_file_name + "': " + get_error();
+        ::close(fd);
+        return false;
+    }
+
+    const auto size = static_cast<std::size_t>(file_info.st_size);
+    void* data = nullptr;
+    // an empty file cannot be mapped
+    if (size > 0)
+    {
+        data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            m_error_string = "Cannot map file '" + m_file_name + "': " + get_error();
+            ::close(fd);
+            return false;
+        }
+    }
+
+    // the mapping keeps the file open
+    ::close(fd);
+
+    m_data = static_cast<const std::uint8_t*>(data);
+    m_size = size;
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool mapped_file_private::close_native()
+{
+    if (m_data && ::munmap(const_cast<std::uint8_t*>(m_data), m_size) == -1)
+    {
+        m_error_string = "Cannot unmap file '" + m_file_name + "': " + get_error();
+        return false;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // NOT RTTR_PLATFORM_WINDOWS
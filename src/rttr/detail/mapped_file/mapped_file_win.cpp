@@ -0,0 +1,138 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#if RTTR_PLATFORM == RTTR_PLATFORM_WINDOWS
+
+#include "rttr/detail/mapped_file/mapped_file_p.h"
+
+#include <string>
+
+namespace
+{
+
+std::wstring convert_utf8_to_utf16(const std::string& source)
+{
+    if (source.empty())
+        return std::wstring();
+
+    const auto size_needed = MultiByteToWideChar(CP_UTF8, 0, &source[0], static_cast<int>(source.size()), NULL, 0);
+    std::wstring result(size_needed, 0);
+    MultiByteToWideChar(CP_UTF8, 0, &source[0], static_cast<int>(source.size()), &result[0], size_needed);
+    return result;
+}
+
+std::string get_error()
+{
+    LPSTR buffer = nullptr;
+    const auto size = FormatMessageA(FORMAT_MESSAGE_ALLOCATE_BUFFER | FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
+                                     NULL, GetLastError(), MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT),
+                                     reinterpret_cast<LPSTR>(&buffer), 0, NULL);
+    std::string result(buffer, size);
+    LocalFree(buffer);
+    return result;
+}
+
+} // end namespace anonymous
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool mapped_file_private::open_native()
+{
+    const HANDLE file = CreateFileW(convert_utf8_to_utf16(m_file_name).c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        m_error_string = "Cannot open file '" + m_file_name + "': " + get_error();
+        return false;
+    }
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size))
+    {
+        m_error_string = "Cannot read the size of file '" + m_file_name + "': " + get_error();
+        CloseHandle(file);
+        return false;
+    }
+
+    const auto size = static_cast<std::size_t>(file_size.QuadPart);
+    const void* data = nullptr;
+    // an empty file cannot be mapped
+    if (size > 0)
+    {
+        m_mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (m_mapping)
+            data = MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+
+        if (!data)
+        {
+            m_error_string = "Cannot map file '" + m_file_name + "': " + get_error();
+            if (m_mapping)
+                CloseHandle(m_mapping);
+            m_mapping = nullptr;
+            CloseHandle(file);
+            return false;
+        }
+    }
+
+    // the mapping keeps the file open
+    CloseHandle(file);
+
+    m_data = static_cast<const std::uint8_t*>(data);
+    m_size = size;
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool mapped_file_private::close_native()
+{
+    if (m_data && !UnmapViewOfFile(m_data))
+    {
+        m_error_string = "Cannot unmap file '" + m_file_name + "': " + get_error();
+        return false;
+    }
+
+    if (m_mapping)
+        CloseHandle(m_mapping);
+
+    m_mapping = nullptr;
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_PLATFORM_WINDOWS
@@ -182,16 +182,16 @@ struct method_accessor
     /////////////////////////////////////////////////////////////////////////////////////
 
     template<std::size_t... Arg_Idx>
-    static RTTR_INLINE variant invoke_variadic_impl(const F& func_ptr, const instance& obj, index_sequence<Arg_Idx...>, const std::vector<argument>& arg_list)
+    static RTTR_INLINE variant invoke_variadic_impl(const F& func_ptr, const instance& obj, index_sequence<Arg_Idx...>, const argument* arg_list)
     {
         return invoker_class::invoke(func_ptr, obj, arg_list[Arg_Idx]...);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////
 
-    static RTTR_INLINE variant invoke_variadic(const F& func_ptr, const instance& obj, const std::vector<argument>& arg_list)
+    static RTTR_INLINE variant invoke_variadic(const F& func_ptr, const instance& obj, const argument* arg_list, std::size_t arg_list_count)
     {
-        if (arg_list.size() == arg_count)
+        if (arg_list_count == arg_count)
             return invoke_variadic_impl(func_ptr, obj, make_index_sequence<arg_count>(), arg_list);
         else
             return variant();
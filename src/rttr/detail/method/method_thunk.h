@@ -0,0 +1,228 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_METHOD_THUNK_H_
+#define RTTR_METHOD_THUNK_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/function_traits.h"
+#include "rttr/detail/misc/std_type_traits.h"
+#include "rttr/detail/policies/meth_policies.h"
+#include "rttr/detail/type/type_name.h"
+#include "rttr/string_view.h"
+
+#include <tuple>
+#include <utility>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * A type erased entry point, which calls the underlying function of a method wrapper directly.
+ *
+ * Before \p m_thunk can be invoked, it has to be casted back to the exact function pointer type,
+ * which was used to request it. \p m_func points to the stored function accessor.
+ */
+struct typed_thunk
+{
+    using thunk_func = void(*)();
+
+    thunk_func  m_thunk;
+    const void* m_func;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename F, typename Policy, bool Is_Member, typename Arg_Types>
+struct method_thunk_invoker;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename F, typename... Args>
+struct method_thunk_invoker<F, default_invoke, true, std::tuple<Args...>>
+{
+    using class_t = typename function_traits<F>::class_type;
+    using return_type = typename function_traits<F>::return_type;
+
+    template<typename Obj>
+    static return_type invoke(const void* func, Obj& obj, Args... args)
+    {
+        conditional_t<std::is_const<Obj>::value, const class_t, class_t>& self = obj;
+        return (self.*(*static_cast<const F*>(func)))(std::forward<Args>(args)...);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename F, typename... Args>
+struct method_thunk_invoker<F, default_invoke, false, std::tuple<Args...>>
+{
+    using return_type = typename function_traits<F>::return_type;
+
+    static return_type invoke(const void* func, Args... args)
+    {
+        return (*static_cast<const F*>(func))(std::forward<Args>(args)...);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename F, typename... Args>
+struct method_thunk_invoker<F, discard_return, true, std::tuple<Args...>>
+{
+    using class_t = typename function_traits<F>::class_type;
+    using return_type = void;
+
+    template<typename Obj>
+    static return_type invoke(const void* func, Obj& obj, Args... args)
+    {
+        conditional_t<std::is_const<Obj>::value, const class_t, class_t>& self = obj;
+        (self.*(*static_cast<const F*>(func)))(std::forward<Args>(args)...);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename F, typename... Args>
+struct method_thunk_invoker<F, discard_return, false, std::tuple<Args...>>
+{
+    using return_type = void;
+
+    static return_type invoke(const void* func, Args... args)
+    {
+        (*static_cast<const F*>(func))(std::forward<Args>(args)...);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename F, typename... Args>
+struct method_thunk_invoker<F, return_as_ptr, true, std::tuple<Args...>>
+{
+    using class_t = typename function_traits<F>::class_type;
+    using return_type = remove_reference_t<typename function_traits<F>::return_type>*;
+
+    template<typename Obj>
+    static return_type invoke(const void* func, Obj& obj, Args... args)
+    {
+        conditional_t<std::is_const<Obj>::value, const class_t, class_t>& self = obj;
+        return &(self.*(*static_cast<const F*>(func)))(std::forward<Args>(args)...);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename F, typename... Args>
+struct method_thunk_invoker<F, return_as_ptr, false, std::tuple<Args...>>
+{
+    using return_type = remove_reference_t<typename function_traits<F>::return_type>*;
+
+    static return_type invoke(const void* func, Args... args)
+    {
+        return &(*static_cast<const F*>(func))(std::forward<Args>(args)...);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns a \ref typed_thunk for the function accessor \p F, when the requested \p signature
+ * matches exactly the signature of the thunk; otherwise an empty thunk is returned.
+ *
+ * The signature is the compiler generated name of the thunk function pointer type: `R(*)(const void*, Args...)`;
+ * it is compared by name, so requesting a thunk does not register any type.
+ * For member functions the first argument is the object, either as reference to the class type
+ * of the member function pointer or as reference to the declaring type of the method.
+ * A const reference is only accepted for const member functions.
+ */
+template<typename F, typename Policy, typename Declaring_Type, bool Is_Member = std::is_member_function_pointer<F>::value>
+struct method_thunk;
+
+template<typename F, typename Policy, typename Declaring_Type>
+struct method_thunk<F, Policy, Declaring_Type, false>
+{
+    using invoker = method_thunk_invoker<F, Policy, false, typename function_traits<F>::arg_types>;
+
+    static typed_thunk get(string_view signature, const F& func) RTTR_NOEXCEPT
+    {
+        using thunk_func = decltype(&invoker::invoke);
+        if (signature == get_type_name<thunk_func>())
+            return {reinterpret_cast<typed_thunk::thunk_func>(&invoker::invoke), &func};
+        else
+            return {nullptr, nullptr};
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename F, typename Policy, typename Declaring_Type>
+struct method_thunk<F, Policy, Declaring_Type, true>
+{
+    using invoker = method_thunk_invoker<F, Policy, true, typename function_traits<F>::arg_types>;
+    using class_t = typename function_traits<F>::class_type;
+    using is_const_func = is_const_member_func<F>;
+    using is_derived_declaring_type = std::integral_constant<bool, std::is_base_of<class_t, Declaring_Type>::value &&
+                                                                   !std::is_same<class_t, Declaring_Type>::value>;
+
+    template<typename Obj>
+    static bool try_get(string_view signature, const F& func, typed_thunk& result, std::true_type) RTTR_NOEXCEPT
+    {
+        using thunk_func = decltype(&invoker::template invoke<Obj>);
+        if (signature != get_type_name<thunk_func>())
+            return false;
+
+        result = {reinterpret_cast<typed_thunk::thunk_func>(&invoker::template invoke<Obj>), &func};
+        return true;
+    }
+
+    template<typename Obj>
+    static bool try_get(string_view, const F&, typed_thunk&, std::false_type) RTTR_NOEXCEPT
+    {
+        return false;
+    }
+
+    static typed_thunk get(string_view signature, const F& func) RTTR_NOEXCEPT
+    {
+        typed_thunk result = {nullptr, nullptr};
+        try_get<class_t>(signature, func, result, std::true_type()) ||
+        try_get<const class_t>(signature, func, result, is_const_func()) ||
+        try_get<Declaring_Type>(signature, func, result, is_derived_declaring_type()) ||
+        try_get<const Declaring_Type>(signature, func, result, std::integral_constant<bool, is_const_func::value &&
+                                                                                              is_derived_declaring_type::value>());
+        return result;
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_METHOD_THUNK_H_
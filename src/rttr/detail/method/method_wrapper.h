@@ -33,6 +33,7 @@
 #include "rttr/detail/misc/function_traits.h"
 #include "rttr/detail/type/accessor_type.h"
 #include "rttr/detail/method/method_accessor.h"
+#include "rttr/detail/method/method_thunk.h"
 #include "rttr/detail/default_arguments/default_arguments.h"
 #include "rttr/detail/default_arguments/invoke_with_defaults.h"
 #include "rttr/detail/parameter_info/parameter_infos.h"
@@ -115,9 +116,14 @@ class method_wrapper<F, Declaring_Type, Acc_Level, Policy, default_args<>, param
             return method_accessor<F, Policy>::invoke(m_func_acc, object, arg1, arg2, arg3, arg4, arg5, arg6);
         }
 
-        variant invoke_variadic(const instance& object, std::vector<argument>& args) const
+        variant invoke_variadic(const instance& object, const argument* args, std::size_t arg_count) const
         {
-            return method_accessor<F, Policy>::invoke_variadic(m_func_acc, object, args);
+            return method_accessor<F, Policy>::invoke_variadic(m_func_acc, object, args, arg_count);
+        }
+
+        typed_thunk get_typed_thunk(string_view signature) const RTTR_NOEXCEPT
+        {
+            return method_thunk<F, Policy, Declaring_Type>::get(signature, m_func_acc);
         }
 
         void visit(visitor& visitor, method meth) const RTTR_NOEXCEPT
@@ -198,14 +204,19 @@ class method_wrapper<F, Declaring_Type, Acc_Level, Policy, default_args<Default_
             return invoke_with_defaults::invoke(m_func_acc, object, m_def_args.m_args, arg1, arg2, arg3, arg4, arg5, arg6);
         }
 
-        variant invoke_variadic(const instance& object, std::vector<argument>& args) const
+        variant invoke_variadic(const instance& object, const argument* args, std::size_t arg_count) const
         {
-            if (args.size() <= function_traits<F>::arg_count)
-                return invoke_variadic_helper<invoke_with_defaults, arg_index_sequence>::invoke(args, m_func_acc, object, m_def_args.m_args);
+            if (arg_count <= function_traits<F>::arg_count)
+                return invoke_variadic_helper<invoke_with_defaults, arg_index_sequence>::invoke(args, arg_count, m_func_acc, object, m_def_args.m_args);
             else
                 return variant();
         }
 
+        typed_thunk get_typed_thunk(string_view signature) const RTTR_NOEXCEPT
+        {
+            return method_thunk<F, Policy, Declaring_Type>::get(signature, m_func_acc);
+        }
+
         void visit(visitor& visitor, method meth) const RTTR_NOEXCEPT
         {
             auto obj = make_method_info<Declaring_Type, Policy, F>(meth, m_func_acc);
@@ -274,9 +285,14 @@ class method_wrapper<F, Declaring_Type, Acc_Level, Policy, default_args<>, param
             return method_accessor<F, Policy>::invoke(m_func_acc, object, arg1, arg2, arg3, arg4, arg5, arg6);
         }
 
-        variant invoke_variadic(const instance& object, std::vector<argument>& args) const
+        variant invoke_variadic(const instance& object, const argument* args, std::size_t arg_count) const
         {
-            return method_accessor<F, Policy>::invoke_variadic(m_func_acc, object, args);
+            return method_accessor<F, Policy>::invoke_variadic(m_func_acc, object, args, arg_count);
+        }
+
+        typed_thunk get_typed_thunk(string_view signature) const RTTR_NOEXCEPT
+        {
+            return method_thunk<F, Policy, Declaring_Type>::get(signature, m_func_acc);
         }
 
         void visit(visitor& visitor, method meth) const RTTR_NOEXCEPT
@@ -351,14 +367,19 @@ class method_wrapper<F, Declaring_Type, Acc_Level, Policy, default_args<Default_
             return invoke_with_defaults::invoke(m_func_acc, object, m_def_args.m_args, arg1, arg2, arg3, arg4, arg5, arg6);
         }
 
-        variant invoke_variadic(const instance& object, std::vector<argument>& args) const
+        variant invoke_variadic(const instance& object, const argument* args, std::size_t arg_count) const
         {
-            if (args.size() <= function_traits<F>::arg_count)
-                return invoke_variadic_helper<invoke_with_defaults, arg_index_sequence>::invoke(args, m_func_acc, object, m_def_args.m_args);
+            if (arg_count <= function_traits<F>::arg_count)
+                return invoke_variadic_helper<invoke_with_defaults, arg_index_sequence>::invoke(args, arg_count, m_func_acc, object, m_def_args.m_args);
             else
                 return variant();
         }
 
+        typed_thunk get_typed_thunk(string_view signature) const RTTR_NOEXCEPT
+        {
+            return method_thunk<F, Policy, Declaring_Type>::get(signature, m_func_acc);
+        }
+
         void visit(visitor& visitor, method meth) const RTTR_NOEXCEPT
         {
             auto obj = make_method_info<Declaring_Type, Policy, F>(meth, m_func_acc);
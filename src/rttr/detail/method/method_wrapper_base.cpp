@@ -223,13 +223,20 @@ variant method_wrapper_base::invoke(instance& object, argument& arg1, argument&
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
-variant method_wrapper_base::invoke_variadic(const instance& object, std::vector<argument>& args) const
+variant method_wrapper_base::invoke_variadic(const instance& object, const argument* args, std::size_t arg_count) const
 {
     return variant();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+typed_thunk method_wrapper_base::get_typed_thunk(string_view) const RTTR_NOEXCEPT
+{
+    return {nullptr, nullptr};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void method_wrapper_base::visit(visitor& visitor, method m) const RTTR_NOEXCEPT
 {
 
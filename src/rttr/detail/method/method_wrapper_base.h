@@ -30,6 +30,7 @@
 
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/detail/metadata/metadata_handler.h"
+#include "rttr/detail/method/method_thunk.h"
 #include "rttr/type.h"
 #include "rttr/variant.h"
 #include "rttr/array_range.h"
@@ -87,7 +88,9 @@ class RTTR_API method_wrapper_base
         virtual variant invoke(instance& object, argument& arg1, argument& arg2, argument& arg3,
                                argument& arg4, argument& arg5, argument& arg6) const;
 
-        virtual variant invoke_variadic(const instance& object, std::vector<argument>& args) const;
+        virtual variant invoke_variadic(const instance& object, const argument* args, std::size_t arg_count) const;
+
+        virtual typed_thunk get_typed_thunk(string_view signature) const RTTR_NOEXCEPT;
 
         virtual void visit(visitor& visitor, method m) const RTTR_NOEXCEPT;
     protected:
@@ -32,6 +32,7 @@
 #include "rttr/detail/misc/misc_type_traits.h"
 #include "rttr/detail/misc/std_type_traits.h"
 
+#include <cstddef>
 #include <type_traits>
 #include <functional>
 #include <tuple>
@@ -175,6 +176,25 @@ namespace detail
     {
     };
 
+    /////////////////////////////////////////////////////////////////////////////////////
+    // returns an std::true_type, when the given type F is a const qualified member function pointer
+    template<typename F>
+    struct is_const_member_func : std::false_type {};
+
+    template<typename R, typename C, typename... Args>
+    struct is_const_member_func<R (C::*)(Args...) const> : std::true_type {};
+
+    template<typename R, typename C, typename... Args>
+    struct is_const_member_func<R (C::*)(Args...) const volatile> : std::true_type {};
+
+#ifndef RTTR_NO_CXX17_NOEXCEPT_FUNC_TYPE
+    template<typename R, typename C, typename... Args>
+    struct is_const_member_func<R (C::*)(Args...) const noexcept> : std::true_type {};
+
+    template<typename R, typename C, typename... Args>
+    struct is_const_member_func<R (C::*)(Args...) const volatile noexcept> : std::true_type {};
+#endif
+
     /////////////////////////////////////////////////////////////////////////////////////
     // returns an std::true_type, when the given type F is a function type; otherwise an std::false_type.
     template<typename F>
@@ -34,6 +34,7 @@
 #include "rttr/detail/misc/misc_type_traits.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -84,6 +85,22 @@ namespace detail
     using index_sequence_for = make_index_sequence<sizeof...(T)>;
 
 
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+// Returns the byte offset of the data member \p acc inside an object of type \p C.
+// The address of the member is calculated inside of real, suitable aligned storage for a \p C;
+// no object is constructed and no value is accessed, so it works also for types which are not standard layout.
+
+template<typename C, typename A>
+RTTR_INLINE std::size_t get_member_offset(A C::* acc) RTTR_NOEXCEPT
+{
+    typename std::aligned_storage<sizeof(C), alignof(C)>::type storage;
+    const char* base = reinterpret_cast<const char*>(&storage);
+    const C* obj = reinterpret_cast<const C*>(&storage);
+    return static_cast<std::size_t>(reinterpret_cast<const char*>(std::addressof(obj->*acc)) - base);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,189 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_OBJECT_POOL_P_H_
+#define RTTR_OBJECT_POOL_P_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include "rttr/type.h"
+#include "rttr/constructor.h"
+#include "rttr/destructor.h"
+#include "rttr/variant.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * A free storage slot of an \ref object_pool.
+ * As long as the slot is unused, its storage is reused to link it to the next free slot.
+ * The first slot of a batch stores additionally the number of slots in the batch
+ * and the link to the next batch, when it is stored in the overflow list.
+ */
+struct pool_slot
+{
+    pool_slot*  m_next;
+    pool_slot*  m_next_batch;
+    std::size_t m_count;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The thread local cache of free slots of one pool, a simple chain with \p m_count slots.
+ */
+struct pool_magazine
+{
+    pool_slot*  m_head  = nullptr;
+    std::size_t m_count = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The memory of an \ref object_pool, which is shared by all threads.
+ *
+ * The memory is allocated in blocks, which grow geometrically, so only a small, fixed amount
+ * of blocks has to be tracked and the ownership of a slot can be checked without a lock.
+ *
+ * Free slots are exchanged between the threads in batches of at most \p m_batch_size slots.
+ * A batch is stored in one of the bins, which are taken and filled with a single atomic operation;
+ * because a bin is always taken with all of its content, the free list does not suffer from the ABA problem.
+ * Only when all bins are filled, the batches are stored in an overflow list guarded by a mutex.
+ *
+ * The object is shared with the thread local caches, so a terminating thread can give back its free slots,
+ * as long as the pool is alive.
+ */
+class RTTR_LOCAL pool_storage
+{
+public:
+    pool_storage(std::size_t slot_size, std::size_t slot_align, std::size_t batch_size);
+    ~pool_storage();
+
+    pool_storage(const pool_storage&) = delete;
+    pool_storage& operator=(const pool_storage&) = delete;
+
+    std::size_t get_batch_size() const RTTR_NOEXCEPT { return m_batch_size; }
+    std::size_t get_capacity() const RTTR_NOEXCEPT;
+
+    /*!
+     * Returns a batch of free slots, or nullptr when no free slots are available.
+     */
+    pool_slot* pop_batch(std::size_t& count) RTTR_NOEXCEPT;
+
+    /*!
+     * Stores the chain \p first with \p count slots as batch in the free list.
+     */
+    void push_batch(pool_slot* first, std::size_t count) RTTR_NOEXCEPT;
+
+    /*!
+     * Gives back the whole \p magazine in batches to the free list.
+     */
+    void push_magazine(pool_magazine& magazine) RTTR_NOEXCEPT;
+
+    /*!
+     * Allocates a new block, returns one batch of it and stores the remaining slots in the free list.
+     * Returns nullptr, when no further block can be allocated.
+     */
+    pool_slot* allocate_batch(std::size_t& count);
+
+    /*!
+     * Returns true, when \p memory points to the begin of a slot of this storage.
+     */
+    bool owns(const void* memory) const RTTR_NOEXCEPT;
+
+private:
+    std::size_t get_block_slot_count(std::size_t block_index) const RTTR_NOEXCEPT;
+
+private:
+    static RTTR_CONSTEXPR_OR_CONST std::size_t bin_count = 64;
+    static RTTR_CONSTEXPR_OR_CONST std::size_t max_block_count = 48;
+    static RTTR_CONSTEXPR_OR_CONST std::size_t max_block_growth = 16;
+
+    const std::size_t                   m_slot_size;
+    const std::size_t                   m_slot_align;
+    const std::size_t                   m_batch_size;
+
+    std::atomic<pool_slot*>             m_bins[bin_count];
+    std::atomic<std::size_t>            m_bin_hint;
+
+    std::mutex                          m_overflow_mutex;
+    pool_slot*                          m_overflow;
+    std::atomic<bool>                   m_has_overflow;
+
+    std::mutex                          m_block_mutex;
+    std::atomic<std::size_t>            m_block_count;
+    std::atomic<std::size_t>            m_capacity;
+    std::atomic<std::uintptr_t>         m_blocks[max_block_count];
+    std::unique_ptr<unsigned char[]>    m_block_memory[max_block_count];
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * This class contains the private implementation of the \ref object_pool class.
+ */
+class RTTR_LOCAL object_pool_private
+{
+public:
+    object_pool_private(const type& t, std::size_t objects_per_block);
+    ~object_pool_private();
+
+    bool is_valid() const RTTR_NOEXCEPT;
+    type get_type() const RTTR_NOEXCEPT;
+    std::size_t get_capacity() const RTTR_NOEXCEPT;
+
+    variant create();
+    bool destroy(variant& obj) RTTR_NOEXCEPT;
+
+private:
+    pool_magazine& get_local_magazine();
+
+    void* pop_slot();
+    void push_slot(void* memory) RTTR_NOEXCEPT;
+
+private:
+    type                                        m_type;
+    type                                        m_ptr_type;
+    constructor                                 m_ctor;
+    destructor                                  m_dtor;
+    bool                                        m_is_valid;
+    const std::uint64_t                         m_id;
+    std::shared_ptr<pool_storage>               m_storage;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_OBJECT_POOL_P_H_
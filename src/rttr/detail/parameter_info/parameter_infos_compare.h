@@ -71,10 +71,9 @@ struct compare_with_type_list
 
 struct compare_with_arg_list
 {
-    static RTTR_INLINE bool compare(const array_range<parameter_info>& param_list, const std::vector<argument>& args)
+    static RTTR_INLINE bool compare(const array_range<parameter_info>& param_list, const argument* args, std::size_t arg_count)
     {
         const auto param_count = param_list.size();
-        const auto arg_count = args.size();
         if (arg_count > param_count)
             return false;
 
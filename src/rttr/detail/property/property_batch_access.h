@@ -0,0 +1,237 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_PROPERTY_BATCH_ACCESS_H_
+#define RTTR_PROPERTY_BATCH_ACCESS_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/std_type_traits.h"
+#include "rttr/array_range.h"
+#include "rttr/instance.h"
+#include "rttr/argument.h"
+#include "rttr/variant.h"
+#include "rttr/variant_sequential_view.h"
+
+#include <type_traits>
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Checks whether the sequential container \p output can store \p count values of type \p value_type
+ * and resizes it accordingly. Containers with a fixed size must already have the size \p count.
+ */
+RTTR_API bool prepare_batch_output(variant_sequential_view& output, const type& value_type, std::size_t count);
+
+/*!
+ * Checks whether the sequential container \p input contains exactly \p count values of type \p value_type.
+ */
+RTTR_API bool check_batch_input(const variant_sequential_view& input, const type& value_type, std::size_t count);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Provides typed access to the container of a \ref variant_sequential_view,
+ * when its type is known; so the items can be accessed without a \ref variant or \ref argument per item.
+ */
+struct variant_sequential_view_access
+{
+    template<typename Container>
+    static Container* get_container(variant_sequential_view& view)
+    {
+        const auto& view_p = view.m_view;
+        if (view_p.is_const_container() || view_p.get_type() != type::get<Container>())
+            return nullptr;
+
+        return static_cast<Container*>(view_p.get_container());
+    }
+
+    template<typename Container>
+    static const Container* get_container(const variant_sequential_view& view)
+    {
+        const auto& view_p = view.m_view;
+        if (view_p.get_type() != type::get<Container>())
+            return nullptr;
+
+        return static_cast<const Container*>(view_p.get_container());
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns true, when every object in \p objects can be converted to the class type \p C.
+ */
+template<typename C>
+RTTR_INLINE bool can_convert_batch_objects(array_range<instance> objects)
+{
+    for (const auto& obj : objects)
+    {
+        if (!obj.try_convert<C>())
+            return false;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// The items of a sequential container are returned wrapped inside a 'std::reference_wrapper',
+// they are accessed directly; except for pointers, because the wrapped address of a pointer is its pointee.
+
+template<typename A>
+RTTR_INLINE enable_if_t<!std::is_pointer<A>::value, const A&> get_batch_item(const variant& item)
+{
+    return item.get_wrapped_value<A>();
+}
+
+template<typename A>
+RTTR_INLINE enable_if_t<std::is_pointer<A>::value, A> get_batch_item(const variant& item)
+{
+    return (item.get_type().is_wrapper() ? item.extract_wrapped_value() : item).template get_value<A>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// arrays cannot be stored in a 'std::vector', so they are always accessed through the view
+
+template<typename A>
+using is_batch_vector_supported = std::integral_constant<bool, !std::is_array<A>::value>;
+
+template<typename C, typename A, typename Getter>
+RTTR_INLINE bool get_batch_vector_values(array_range<instance> objects, variant_sequential_view& output,
+                                         const Getter& getter, std::true_type)
+{
+    auto vec = variant_sequential_view_access::get_container<std::vector<remove_cv_t<A>>>(output);
+    if (!vec)
+        return false;
+
+    std::size_t index = 0;
+    for (const auto& obj : objects)
+        (*vec)[index++] = getter(*obj.try_convert<C>());
+
+    return true;
+}
+
+template<typename C, typename A, typename Getter>
+RTTR_INLINE bool get_batch_vector_values(array_range<instance>, variant_sequential_view&, const Getter&, std::false_type)
+{
+    return false;
+}
+
+template<typename C, typename A, typename Setter>
+RTTR_INLINE bool set_batch_vector_values(array_range<instance> objects, const variant_sequential_view& input,
+                                         const Setter& setter, std::true_type)
+{
+    auto vec = variant_sequential_view_access::get_container<std::vector<remove_cv_t<A>>>(input);
+    if (!vec)
+        return false;
+
+    std::size_t index = 0;
+    for (const auto& obj : objects)
+        setter(*obj.try_convert<C>(), (*vec)[index++]);
+
+    return true;
+}
+
+template<typename C, typename A, typename Setter>
+RTTR_INLINE bool set_batch_vector_values(array_range<instance>, const variant_sequential_view&, const Setter&, std::false_type)
+{
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Reads the value of every object in \p objects with the given \p getter and writes it into \p output.
+ *
+ * The value type and the objects are validated before anything is written.
+ * For a `std::vector<A>` the values are assigned directly to its items;
+ * every other container is written through \ref variant_sequential_view::set_value().
+ */
+template<typename C, typename A, typename Getter>
+RTTR_INLINE bool get_batch_values(array_range<instance> objects, variant_sequential_view& output, const Getter& getter)
+{
+    if (!output.is_valid() || output.get_value_type() != type::get<A>() || !can_convert_batch_objects<C>(objects))
+        return false;
+
+    if (!prepare_batch_output(output, type::get<A>(), objects.size()))
+        return false;
+
+    if (get_batch_vector_values<C, A>(objects, output, getter, is_batch_vector_supported<A>()))
+        return true;
+
+    std::size_t index = 0;
+    for (const auto& obj : objects)
+    {
+        if (!output.set_value(index, argument(getter(*obj.try_convert<C>()))))
+            return false;
+
+        ++index;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Writes every value of \p input with the given \p setter into the corresponding object in \p objects.
+ *
+ * The value type, the size and the objects are validated before any object is modified.
+ * For a `std::vector<A>` the items are read directly;
+ * every other container is read through \ref variant_sequential_view::get_value().
+ */
+template<typename C, typename A, typename Setter>
+RTTR_INLINE bool set_batch_values(array_range<instance> objects, const variant_sequential_view& input, const Setter& setter)
+{
+    if (!check_batch_input(input, type::get<A>(), objects.size()) || !can_convert_batch_objects<C>(objects))
+        return false;
+
+    if (set_batch_vector_values<C, A>(objects, input, setter, is_batch_vector_supported<A>()))
+        return true;
+
+    std::size_t index = 0;
+    for (const auto& obj : objects)
+    {
+        const variant item = input.get_value(index);
+        setter(*obj.try_convert<C>(), get_batch_item<A>(item));
+        ++index;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_PROPERTY_BATCH_ACCESS_H_
@@ -0,0 +1,291 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_PROPERTY_THUNK_H_
+#define RTTR_PROPERTY_THUNK_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/detail/misc/function_traits.h"
+#include "rttr/detail/misc/std_type_traits.h"
+#include "rttr/detail/property/typed_property_thunk.h"
+#include "rttr/detail/type/type_name.h"
+#include "rttr/string_view.h"
+
+#include <cstddef>
+#include <utility>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Setter, typename C, typename V>
+RTTR_INLINE void call_setter(C& obj, const Setter& setter, const V& value, std::true_type)
+{
+    (obj.*setter)(value);
+}
+
+template<typename Setter, typename C, typename V>
+RTTR_INLINE void call_setter(C& obj, const Setter& setter, const V& value, std::false_type)
+{
+    using arg_type = typename param_types<Setter, 0>::type;
+    V copy(value);
+    (obj.*setter)(std::forward<arg_type>(copy));
+}
+
+/*!
+ * Invokes the setter member function \p setter on \p obj with the given \p value.
+ * When the setter takes its argument by non-const reference or rvalue reference,
+ * it gets a copy of \p value, so the given \p value is never modified.
+ */
+template<typename Setter, typename C, typename V>
+RTTR_INLINE void call_setter(C& obj, const Setter& setter, const V& value)
+{
+    using arg_type = typename param_types<Setter, 0>::type;
+    call_setter(obj, setter, value, std::is_convertible<const V&, arg_type>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename C, typename A, bool Is_Array = std::is_array<A>::value>
+struct member_object_thunk_invoker
+{
+    static RTTR_CONSTEXPR_OR_CONST bool is_supported = true;
+    static RTTR_CONSTEXPR_OR_CONST bool is_ref_supported = true;
+    using class_type = C;
+    using value_type = remove_cv_t<A>;
+    using accessor = A (C::*);
+
+    template<typename Obj>
+    static value_type get(const void* acc, const Obj& obj)
+    {
+        const C& self = obj;
+        return self.*(*static_cast<const accessor*>(acc));
+    }
+
+    template<typename Obj>
+    static const value_type& get_ref(const void* acc, const Obj& obj)
+    {
+        const C& self = obj;
+        return self.*(*static_cast<const accessor*>(acc));
+    }
+
+    template<typename Obj>
+    static void set(const void* acc, Obj& obj, const value_type& value)
+    {
+        C& self = obj;
+        self.*(*static_cast<const accessor*>(acc)) = value;
+    }
+};
+
+// arrays cannot be returned by value, so no typed access is available for them
+template<typename C, typename A>
+struct member_object_thunk_invoker<C, A, true>
+{
+    static RTTR_CONSTEXPR_OR_CONST bool is_supported = false;
+    static RTTR_CONSTEXPR_OR_CONST bool is_ref_supported = false;
+    using class_type = C;
+    using value_type = A;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Getter>
+using getter_value_t = remove_cv_t<remove_reference_t<typename function_traits<Getter>::return_type>>;
+
+template<typename Getter, typename Setter, bool Is_Array = std::is_array<getter_value_t<Getter>>::value>
+struct member_func_thunk_invoker
+{
+    static RTTR_CONSTEXPR_OR_CONST bool is_supported = true;
+    // a reference can only be provided, when the getter itself returns one
+    static RTTR_CONSTEXPR_OR_CONST bool is_ref_supported = std::is_reference<typename function_traits<Getter>::return_type>::value;
+    using class_type = typename function_traits<Getter>::class_type;
+    using value_type = getter_value_t<Getter>;
+
+    template<typename Obj>
+    static value_type get(const void* getter, const Obj& obj)
+    {
+        // a getter does not have to be declared const, the same like for property::get_value()
+        class_type& self = const_cast<Obj&>(obj);
+        return (self.*(*static_cast<const Getter*>(getter)))();
+    }
+
+    template<typename Obj>
+    static const value_type& get_ref(const void* getter, const Obj& obj)
+    {
+        class_type& self = const_cast<Obj&>(obj);
+        return (self.*(*static_cast<const Getter*>(getter)))();
+    }
+
+    template<typename Obj>
+    static void set(const void* setter, Obj& obj, const value_type& value)
+    {
+        using setter_class_type = typename function_traits<Setter>::class_type;
+        setter_class_type& self = obj;
+        call_setter(self, *static_cast<const Setter*>(setter), value);
+    }
+};
+
+template<typename Getter, typename Setter>
+struct member_func_thunk_invoker<Getter, Setter, true>
+{
+    static RTTR_CONSTEXPR_OR_CONST bool is_supported = false;
+    static RTTR_CONSTEXPR_OR_CONST bool is_ref_supported = false;
+    using class_type = typename function_traits<Getter>::class_type;
+    using value_type = getter_value_t<Getter>;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns a \ref typed_property_thunk for the given thunk \p Invoker, when the requested \p signature
+ * matches exactly the signature of the getter thunk; otherwise an empty thunk is returned.
+ *
+ * The signature is the compiler generated name of the getter thunk function pointer type:
+ * `T(*)(const void*, const C&)`, where `T` is the value type or, when the \p Invoker supports it, a const reference to it;
+ * it is compared by name, so requesting a thunk does not register any type.
+ * The object can be either the class type of the accessor or the declaring type of the property.
+ * The setter thunk has always the signature `void(*)(const void*, C&, const T&)`.
+ * For read only properties, no setter thunk and no batch setter thunk is provided.
+ * When the \p Invoker does not support typed access (e.g. for array types), always an empty thunk is returned.
+ */
+template<typename Invoker, typename Declaring_Typ, bool Read_Only>
+struct property_thunk
+{
+    using class_type = typename Invoker::class_type;
+    using value_type = typename Invoker::value_type;
+    using is_supported = std::integral_constant<bool, Invoker::is_supported>;
+    using is_ref_supported = std::integral_constant<bool, Invoker::is_ref_supported>;
+    using is_derived_declaring_type = std::integral_constant<bool, Invoker::is_supported &&
+                                                                   std::is_base_of<class_type, Declaring_Typ>::value &&
+                                                                   !std::is_same<class_type, Declaring_Typ>::value>;
+
+    template<typename Obj>
+    static void get_values(const void* getter, const char* objects, std::size_t stride, std::size_t count, value_type* output)
+    {
+        for (std::size_t i = 0; i < count; ++i, objects += stride)
+            output[i] = Invoker::template get<Obj>(getter, *reinterpret_cast<const Obj*>(objects));
+    }
+
+    template<typename Obj>
+    static void set_values(const void* setter, char* objects, std::size_t stride, std::size_t count, const value_type* input)
+    {
+        for (std::size_t i = 0; i < count; ++i, objects += stride)
+            Invoker::template set<Obj>(setter, *reinterpret_cast<Obj*>(objects), input[i]);
+    }
+
+    template<typename Obj>
+    static typed_property_thunk::thunk_func get_setter(std::false_type)
+    {
+        return reinterpret_cast<typed_property_thunk::thunk_func>(&Invoker::template set<Obj>);
+    }
+
+    template<typename Obj>
+    static typed_property_thunk::thunk_func get_setter(std::true_type)
+    {
+        return nullptr;
+    }
+
+    template<typename Obj>
+    static typed_property_thunk::thunk_func get_values_setter(std::false_type)
+    {
+        return reinterpret_cast<typed_property_thunk::thunk_func>(&property_thunk::template set_values<Obj>);
+    }
+
+    template<typename Obj>
+    static typed_property_thunk::thunk_func get_values_setter(std::true_type)
+    {
+        return nullptr;
+    }
+
+    template<typename Obj>
+    static bool is_ref_signature(string_view signature, std::true_type) RTTR_NOEXCEPT
+    {
+        return (signature == get_type_name<decltype(&Invoker::template get_ref<Obj>)>());
+    }
+
+    template<typename Obj>
+    static bool is_ref_signature(string_view, std::false_type) RTTR_NOEXCEPT
+    {
+        return false;
+    }
+
+    template<typename Obj>
+    static typed_property_thunk::thunk_func get_ref_getter(std::true_type) RTTR_NOEXCEPT
+    {
+        return reinterpret_cast<typed_property_thunk::thunk_func>(&Invoker::template get_ref<Obj>);
+    }
+
+    template<typename Obj>
+    static typed_property_thunk::thunk_func get_ref_getter(std::false_type) RTTR_NOEXCEPT
+    {
+        return nullptr;
+    }
+
+    template<typename Obj>
+    static bool try_get(string_view signature, const void* getter, const void* setter,
+                        typed_property_thunk& result, std::true_type) RTTR_NOEXCEPT
+    {
+        typed_property_thunk::thunk_func getter_thunk = nullptr;
+        if (signature == get_type_name<decltype(&Invoker::template get<Obj>)>())
+            getter_thunk = reinterpret_cast<typed_property_thunk::thunk_func>(&Invoker::template get<Obj>);
+        else if (is_ref_signature<Obj>(signature, is_ref_supported()))
+            getter_thunk = get_ref_getter<Obj>(is_ref_supported());
+        else
+            return false;
+
+        result = {getter_thunk,
+                  get_setter<Obj>(std::integral_constant<bool, Read_Only>()),
+                  reinterpret_cast<typed_property_thunk::thunk_func>(&property_thunk::template get_values<Obj>),
+                  get_values_setter<Obj>(std::integral_constant<bool, Read_Only>()),
+                  getter, setter};
+        return true;
+    }
+
+    template<typename Obj>
+    static bool try_get(string_view, const void*, const void*, typed_property_thunk&, std::false_type) RTTR_NOEXCEPT
+    {
+        return false;
+    }
+
+    static typed_property_thunk get(string_view signature, const void* getter, const void* setter) RTTR_NOEXCEPT
+    {
+        typed_property_thunk result = {nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
+        try_get<class_type>(signature, getter, setter, result, is_supported()) ||
+        try_get<Declaring_Typ>(signature, getter, setter, result, is_derived_declaring_type());
+        return result;
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_PROPERTY_THUNK_H_
@@ -37,6 +37,7 @@
 #include "rttr/policy.h"
 #include "rttr/detail/misc/utility.h"
 #include "rttr/detail/property/property_accessor.h"
+#include "rttr/detail/property/property_batch_access.h"
 #include "rttr/detail/visitor/visitor_iterator.h"
 #include "rttr/detail/visitor/property_visitor_invoker.h"
 
@@ -26,6 +26,7 @@
 *************************************************************************************/
 
 #include "rttr/detail/property/property_wrapper_base.h"
+#include "rttr/detail/property/property_batch_access.h"
 
 namespace rttr
 {
@@ -104,6 +105,27 @@ type property_wrapper_base::get_type() const RTTR_NOEXCEPT
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool property_wrapper_base::has_offset() const RTTR_NOEXCEPT
+{
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t property_wrapper_base::get_offset() const RTTR_NOEXCEPT
+{
+    return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool property_wrapper_base::is_trivially_copyable() const RTTR_NOEXCEPT
+{
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant property_wrapper_base::get_metadata(const variant& key) const
 {
     return variant();
@@ -125,6 +147,59 @@ variant property_wrapper_base::get_value(instance& object) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool property_wrapper_base::get_values(array_range<instance> objects, variant_sequential_view& output) const
+{
+    if (!prepare_batch_output(output, get_type(), objects.size()))
+        return false;
+
+    std::size_t index = 0;
+    for (const auto& obj : objects)
+    {
+        instance object = obj;
+        const variant var = get_value(object);
+        if (!var.is_valid() || !output.set_value(index, var))
+            return false;
+
+        ++index;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool property_wrapper_base::set_values(array_range<instance> objects, const variant_sequential_view& input) const
+{
+    if (is_readonly() || !check_batch_input(input, get_type(), objects.size()))
+        return false;
+
+    std::size_t index = 0;
+    for (const auto& obj : objects)
+    {
+        instance object = obj;
+        variant value = input.get_value(index);
+        if (value.get_type().is_wrapper())
+            value = value.extract_wrapped_value();
+
+        argument arg(value);
+        if (!set_value(object, arg))
+            return false;
+
+        ++index;
+    }
+
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+typed_property_thunk property_wrapper_base::get_typed_thunk(string_view) const RTTR_NOEXCEPT
+{
+    return {nullptr, nullptr, nullptr, nullptr, nullptr, nullptr};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 void property_wrapper_base::visit(visitor& visitor, property prop) const RTTR_NOEXCEPT
 {
 
@@ -30,6 +30,7 @@
 
 #include "rttr/detail/base/core_prerequisites.h"
 #include "rttr/detail/metadata/metadata_handler.h"
+#include "rttr/detail/property/property_thunk.h"
 #include "rttr/type.h"
 #include "rttr/variant.h"
 #include "rttr/access_levels.h"
@@ -41,6 +42,7 @@ namespace rttr
 class instance;
 class argument;
 class visitor;
+class variant_sequential_view;
 
 namespace detail
 {
@@ -72,12 +74,24 @@ class RTTR_API property_wrapper_base
 
         virtual type get_type() const RTTR_NOEXCEPT;
 
+        virtual bool has_offset() const RTTR_NOEXCEPT;
+
+        virtual std::size_t get_offset() const RTTR_NOEXCEPT;
+
+        virtual bool is_trivially_copyable() const RTTR_NOEXCEPT;
+
         virtual variant get_metadata(const variant& key) const;
 
         virtual bool set_value(instance& object, argument& arg) const;
 
         virtual variant get_value(instance& object) const;
 
+        virtual bool get_values(array_range<instance> objects, variant_sequential_view& output) const;
+
+        virtual bool set_values(array_range<instance> objects, const variant_sequential_view& input) const;
+
+        virtual typed_property_thunk get_typed_thunk(string_view signature) const RTTR_NOEXCEPT;
+
         virtual void visit(visitor& visitor, property prop) const RTTR_NOEXCEPT;
 
     protected:
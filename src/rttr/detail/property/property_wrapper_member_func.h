@@ -37,6 +37,7 @@ class property_wrapper<member_func_ptr, Declaring_Typ, Getter, Setter, Acc_Level
     : public property_wrapper_base, public metadata_handler<Metadata_Count>
 {
     using return_type   = typename function_traits<Getter>::return_type;
+    using value_type    = getter_value_t<Getter>;
     using arg_type      = typename param_types<Setter, 0>::type;
     using class_type    = typename function_traits<Getter>::class_type;
 
@@ -82,6 +83,28 @@ class property_wrapper<member_func_ptr, Declaring_Typ, Getter, Setter, Acc_Level
                 return variant();
         }
 
+        bool get_values(array_range<instance> objects, variant_sequential_view& output) const
+        {
+            return get_batch_values<class_type, value_type>(objects, output, [this](class_type& obj) -> return_type
+            {
+                return (obj.*m_getter)();
+            });
+        }
+
+        bool set_values(array_range<instance> objects, const variant_sequential_view& input) const
+        {
+            return set_batch_values<class_type, value_type>(objects, input, [this](class_type& obj, const value_type& value)
+            {
+                // the setter can also take its argument by non-const reference, then it gets a copy
+                call_setter(obj, m_setter, value);
+            });
+        }
+
+        typed_property_thunk get_typed_thunk(string_view signature) const RTTR_NOEXCEPT
+        {
+            return property_thunk<member_func_thunk_invoker<Getter, Setter>, Declaring_Typ, false>::get(signature, &m_getter, &m_setter);
+        }
+
         void visit(visitor& visitor, property prop) const RTTR_NOEXCEPT
         {
             auto obj = make_property_getter_setter_info<Declaring_Typ, return_as_copy, Getter, Setter>(prop, m_getter, m_setter);
@@ -102,6 +125,7 @@ class property_wrapper<member_func_ptr, Declaring_Typ, Getter, void, Acc_Level,
     : public property_wrapper_base, public metadata_handler<Metadata_Count>
 {
     using return_type   = typename function_traits<Getter>::return_type;
+    using value_type    = getter_value_t<Getter>;
     using class_type    = typename function_traits<Getter>::class_type;
 
     public:
@@ -137,6 +161,19 @@ class property_wrapper<member_func_ptr, Declaring_Typ, Getter, void, Acc_Level,
                 return variant();
         }
 
+        bool get_values(array_range<instance> objects, variant_sequential_view& output) const
+        {
+            return get_batch_values<class_type, value_type>(objects, output, [this](class_type& obj) -> return_type
+            {
+                return (obj.*m_getter)();
+            });
+        }
+
+        typed_property_thunk get_typed_thunk(string_view signature) const RTTR_NOEXCEPT
+        {
+            return property_thunk<member_func_thunk_invoker<Getter, void>, Declaring_Typ, true>::get(signature, &m_getter, nullptr);
+        }
+
         void visit(visitor& visitor, property prop) const RTTR_NOEXCEPT
         {
             auto obj = make_property_info<Declaring_Typ, return_as_copy, Getter>(prop, m_getter);
@@ -206,6 +243,11 @@ class property_wrapper<member_func_ptr, Declaring_Typ, Getter, Setter, Acc_Level
                 return variant();
         }
 
+        typed_property_thunk get_typed_thunk(string_view signature) const RTTR_NOEXCEPT
+        {
+            return property_thunk<member_func_thunk_invoker<Getter, Setter>, Declaring_Typ, false>::get(signature, &m_getter, &m_setter);
+        }
+
         void visit(visitor& visitor, property prop) const RTTR_NOEXCEPT
         {
             auto obj = make_property_getter_setter_info<Declaring_Typ, return_as_ptr, Getter, Setter>(prop, m_getter, m_setter);
@@ -265,6 +307,11 @@ class property_wrapper<member_func_ptr, Declaring_Typ, Getter, void, Acc_Level,
                 return variant();
         }
 
+        typed_property_thunk get_typed_thunk(string_view signature) const RTTR_NOEXCEPT
+        {
+            return property_thunk<member_func_thunk_invoker<Getter, void>, Declaring_Typ, true>::get(signature, &m_getter, nullptr);
+        }
+
         void visit(visitor& visitor, property prop) const RTTR_NOEXCEPT
         {
             auto obj = make_property_info<Declaring_Typ, return_as_ptr, Getter>(prop, m_getter);
@@ -334,6 +381,11 @@ class property_wrapper<member_func_ptr, Declaring_Typ, Getter, Setter, Acc_Level
                 return variant();
         }
 
+        typed_property_thunk get_typed_thunk(string_view signature) const RTTR_NOEXCEPT
+        {
+            return property_thunk<member_func_thunk_invoker<Getter, Setter>, Declaring_Typ, false>::get(signature, &m_getter, &m_setter);
+        }
+
         void visit(visitor& visitor, property prop) const RTTR_NOEXCEPT
         {
             auto obj = make_property_getter_setter_info<Declaring_Typ, get_as_ref_wrapper, Getter, Setter>(prop, m_getter, m_setter);
@@ -393,6 +445,11 @@ class property_wrapper<member_func_ptr, Declaring_Typ, Getter, void, Acc_Level,
                 return variant();
         }
 
+        typed_property_thunk get_typed_thunk(string_view signature) const RTTR_NOEXCEPT
+        {
+            return property_thunk<member_func_thunk_invoker<Getter, void>, Declaring_Typ, true>::get(signature, &m_getter, nullptr);
+        }
+
         void visit(visitor& visitor, property prop) const RTTR_NOEXCEPT
         {
             auto obj = make_property_info<Declaring_Typ, get_as_ref_wrapper, Getter>(prop, m_getter);
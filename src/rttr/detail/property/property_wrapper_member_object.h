@@ -53,6 +53,11 @@ class property_wrapper<member_object_ptr, Declaring_Typ, A(C::*), void, Acc_Leve
         bool is_static()    const RTTR_NOEXCEPT                 { return false; }
         type get_type()     const RTTR_NOEXCEPT                 { return type::get<A>(); }
 
+        // the value is located at a fixed offset, only when the member belongs to the declaring type itself
+        bool has_offset()   const RTTR_NOEXCEPT                 { return std::is_same<C, Declaring_Typ>::value; }
+        std::size_t get_offset() const RTTR_NOEXCEPT            { return (has_offset() ? get_member_offset(m_acc) : 0); }
+        bool is_trivially_copyable() const RTTR_NOEXCEPT        { return (has_offset() && std::is_trivially_copyable<A>::value); }
+
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         bool set_value(instance& object, argument& arg) const
@@ -72,6 +77,24 @@ class property_wrapper<member_object_ptr, Declaring_Typ, A(C::*), void, Acc_Leve
                 return variant();
         }
 
+        bool get_values(array_range<instance> objects, variant_sequential_view& output) const
+        {
+            return get_batch_values<C, A>(objects, output, [this](C& obj) -> const A& { return obj.*m_acc; });
+        }
+
+        bool set_values(array_range<instance> objects, const variant_sequential_view& input) const
+        {
+            return set_batch_values<C, A>(objects, input, [this](C& obj, const A& value)
+            {
+                property_accessor<A>::set_value(obj.*m_acc, value);
+            });
+        }
+
+        typed_property_thunk get_typed_thunk(string_view signature) const RTTR_NOEXCEPT
+        {
+            return property_thunk<member_object_thunk_invoker<C, A>, Declaring_Typ, false>::get(signature, &m_acc, &m_acc);
+        }
+
         void visit(visitor& visitor, property prop) const RTTR_NOEXCEPT
         {
             auto obj = make_property_info<Declaring_Typ, return_as_copy, accessor>(prop, m_acc);
@@ -108,6 +131,11 @@ class property_wrapper<member_object_ptr, Declaring_Typ, A(C::*), void, Acc_Leve
         bool is_static()    const RTTR_NOEXCEPT                 { return false; }
         type get_type()     const RTTR_NOEXCEPT                 { return type::get<A>(); }
 
+        // the value is located at a fixed offset, only when the member belongs to the declaring type itself
+        bool has_offset()   const RTTR_NOEXCEPT                 { return std::is_same<C, Declaring_Typ>::value; }
+        std::size_t get_offset() const RTTR_NOEXCEPT            { return (has_offset() ? get_member_offset(m_acc) : 0); }
+        bool is_trivially_copyable() const RTTR_NOEXCEPT        { return (has_offset() && std::is_trivially_copyable<A>::value); }
+
         variant get_metadata(const variant& key) const { return metadata_handler<Metadata_Count>::get_metadata(key); }
 
         bool set_value(instance& object, argument& arg) const
@@ -123,6 +151,16 @@ class property_wrapper<member_object_ptr, Declaring_Typ, A(C::*), void, Acc_Leve
                 return variant();
         }
 
+        bool get_values(array_range<instance> objects, variant_sequential_view& output) const
+        {
+            return get_batch_values<C, A>(objects, output, [this](C& obj) -> const A& { return obj.*m_acc; });
+        }
+
+        typed_property_thunk get_typed_thunk(string_view signature) const RTTR_NOEXCEPT
+        {
+            return property_thunk<member_object_thunk_invoker<C, A>, Declaring_Typ, true>::get(signature, &m_acc, nullptr);
+        }
+
         void visit(visitor& visitor, property prop) const RTTR_NOEXCEPT
         {
             auto obj = make_property_info<Declaring_Typ, return_as_copy, accessor>(prop, m_acc);
@@ -183,6 +221,11 @@ class property_wrapper<member_object_ptr, Declaring_Typ, A(C::*), void, Acc_Leve
                 return variant();
         }
 
+        typed_property_thunk get_typed_thunk(string_view signature) const RTTR_NOEXCEPT
+        {
+            return property_thunk<member_object_thunk_invoker<C, A>, Declaring_Typ, false>::get(signature, &m_acc, &m_acc);
+        }
+
         void visit(visitor& visitor, property prop) const RTTR_NOEXCEPT
         {
             auto obj = make_property_info<Declaring_Typ, return_as_ptr, accessor>(prop, m_acc);
@@ -234,6 +277,11 @@ class property_wrapper<member_object_ptr, Declaring_Typ, A(C::*), void, Acc_Leve
                 return variant();
         }
 
+        typed_property_thunk get_typed_thunk(string_view signature) const RTTR_NOEXCEPT
+        {
+            return property_thunk<member_object_thunk_invoker<C, A>, Declaring_Typ, true>::get(signature, &m_acc, nullptr);
+        }
+
         void visit(visitor& visitor, property prop) const RTTR_NOEXCEPT
         {
             auto obj = make_property_info<Declaring_Typ, return_as_ptr, accessor>(prop, m_acc);
@@ -290,6 +338,11 @@ class property_wrapper<member_object_ptr, Declaring_Typ, A(C::*), void, Acc_Leve
                 return variant();
         }
 
+        typed_property_thunk get_typed_thunk(string_view signature) const RTTR_NOEXCEPT
+        {
+            return property_thunk<member_object_thunk_invoker<C, A>, Declaring_Typ, false>::get(signature, &m_acc, &m_acc);
+        }
+
         void visit(visitor& visitor, property prop) const RTTR_NOEXCEPT
         {
             auto obj = make_property_info<Declaring_Typ, get_as_ref_wrapper, accessor>(prop, m_acc);
@@ -341,6 +394,11 @@ class property_wrapper<member_object_ptr, Declaring_Typ, A(C::*), void, Acc_Leve
                 return variant();
         }
 
+        typed_property_thunk get_typed_thunk(string_view signature) const RTTR_NOEXCEPT
+        {
+            return property_thunk<member_object_thunk_invoker<C, A>, Declaring_Typ, true>::get(signature, &m_acc, nullptr);
+        }
+
         void visit(visitor& visitor, property prop) const RTTR_NOEXCEPT
         {
             auto obj = make_property_info<Declaring_Typ, get_as_ref_wrapper, accessor>(prop, m_acc);
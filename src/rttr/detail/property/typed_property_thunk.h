@@ -0,0 +1,61 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_TYPED_PROPERTY_THUNK_H_
+#define RTTR_TYPED_PROPERTY_THUNK_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * Type erased entry points, which read and write the value of a property wrapper directly.
+ *
+ * Before the thunks can be invoked, they have to be casted back to the exact function pointer types,
+ * which were used to request them. \p m_getter and \p m_setter point to the stored accessors.
+ * The batch thunks read/write the values of many objects, which are located in memory with a fixed stride.
+ * For read only properties \p m_setter_thunk and \p m_set_values_thunk are a nullptr.
+ */
+struct typed_property_thunk
+{
+    using thunk_func = void(*)();
+
+    thunk_func  m_getter_thunk;
+    thunk_func  m_setter_thunk;
+    thunk_func  m_get_values_thunk;
+    thunk_func  m_set_values_thunk;
+    const void* m_getter;
+    const void* m_setter;
+};
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_TYPED_PROPERTY_THUNK_H_
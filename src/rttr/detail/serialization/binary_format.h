@@ -0,0 +1,116 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_BINARY_FORMAT_H_
+#define RTTR_BINARY_FORMAT_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include "rttr/detail/serialization/serialization_utility.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace rttr
+{
+namespace detail
+{
+
+/*!
+ * The layout of the binary format, written by \ref to_binary():
+ *
+ * \code
+ *  header:     char[4]   magic "RTTB"
+ *              uint8     format version
+ *              uint8     byte order of the writer (1 = little endian, 2 = big endian)
+ *              uint16    reserved
+ *              uint64    fingerprint of the access plan of the root type
+ *  object:     uint32    size of the object in bytes, including this field
+ *              uint32    number of entries N
+ *              uint32[N] offsets of the values, relative to the start of the object; zero when the value was not written
+ *              ...       the values in the order of the access plan entries
+ * \endcode
+ *
+ * Arithmetic values and enumerations are written with their size in memory, strings with an uint32 length prefix,
+ * containers with an uint32 item count followed by the items (or key and value pairs) and pointers and wrappers
+ * with an uint8 flag, followed by the object when the flag is one.
+ * Values of any other type are written as string, see \ref variant::to_string().
+ */
+struct binary_header
+{
+    char            m_magic[4];
+    std::uint8_t    m_version;
+    std::uint8_t    m_byte_order;
+    std::uint16_t   m_reserved;
+    std::uint64_t   m_fingerprint;
+};
+
+RTTR_STATIC_CONSTEXPR std::uint8_t binary_format_version = 1;
+RTTR_STATIC_CONSTEXPR std::size_t binary_object_header_size = 2 * sizeof(std::uint32_t);
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE std::uint8_t get_host_byte_order() RTTR_NOEXCEPT
+{
+    const std::uint16_t value = 1;
+    std::uint8_t first_byte;
+    std::memcpy(&first_byte, &value, 1);
+    return (first_byte == 1 ? 1 : 2);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE binary_header make_binary_header(std::uint64_t fingerprint) RTTR_NOEXCEPT
+{
+    binary_header header;
+    std::memcpy(header.m_magic, "RTTB", 4);
+    header.m_version        = binary_format_version;
+    header.m_byte_order     = get_host_byte_order();
+    header.m_reserved       = 0;
+    header.m_fingerprint    = fingerprint;
+    return header;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns true, when \p header was written by a compatible writer.
+ * The fingerprint has to be checked separately.
+ */
+RTTR_INLINE bool is_valid_binary_header(const binary_header& header) RTTR_NOEXCEPT
+{
+    return (std::memcmp(header.m_magic, "RTTB", 4) == 0 &&
+            header.m_version == binary_format_version &&
+            header.m_byte_order == get_host_byte_order());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_BINARY_FORMAT_H_
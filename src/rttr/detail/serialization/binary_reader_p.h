@@ -0,0 +1,474 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_BINARY_READER_P_H_
+#define RTTR_BINARY_READER_P_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include "rttr/detail/serialization/binary_format.h"
+#include "rttr/variant.h"
+#include "rttr/variant_sequential_view.h"
+#include "rttr/variant_associative_view.h"
+
+#include <cstring>
+#include <string>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Reads objects in the binary format, see \ref binary_header.
+ */
+class RTTR_LOCAL binary_reader
+{
+public:
+    binary_reader(const std::uint8_t* data, std::size_t size) : m_pos(data), m_end(data + size) {}
+
+    bool read(const instance& obj)
+    {
+        binary_header header;
+        if (!read_raw(header) || !is_valid_binary_header(header))
+            return false;
+
+        const auto plan = access_plan::get(obj.get_derived_type());
+        if (!plan.is_valid() || header.m_fingerprint != plan.get_fingerprint())
+            return false;
+
+        return read_object(obj, plan);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    bool read_object(const instance& obj, const access_plan& plan)
+    {
+        const auto start = m_pos;
+        std::size_t object_size, count;
+        if (!read_size(object_size) || !read_size(count) ||
+            object_size > static_cast<std::size_t>(m_end - start) ||
+            object_size < binary_object_header_size + count * sizeof(std::uint32_t))
+        {
+            return false;
+        }
+
+        const auto entries = plan.get_entries();
+        if (count != entries.size())
+            return false;
+
+        const auto object_end = start + object_size;
+        const auto offset_table = m_pos;
+        std::size_t index = 0;
+        for (const auto& entry : entries)
+        {
+            std::uint32_t offset;
+            std::memcpy(&offset, offset_table + index * sizeof(std::uint32_t), sizeof(offset));
+            ++index;
+            if (offset == 0)
+                continue;
+
+            if (offset < binary_object_header_size + count * sizeof(std::uint32_t) || offset >= object_size)
+                return false;
+
+            m_pos = start + offset;
+            const auto end = m_end;
+            m_end = object_end;
+            const bool result = read_entry(obj, entry);
+            m_end = end;
+            if (!result)
+                return false;
+        }
+
+        m_pos = object_end;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    /*!
+     * Reads a value, which is not updated in-place, i.e. numbers, enumerations and strings.
+     */
+    bool read_value(variant& var, access_kind kind, const type& t)
+    {
+        bool ok = false;
+        switch (kind)
+        {
+            case access_kind::boolean:
+            {
+                std::uint8_t value;
+                if (!read_raw(value))
+                    return false;
+
+                var = (value != 0);
+                return true;
+            }
+            case access_kind::character:    ok = read_number<char>(var); break;
+            case access_kind::int8:         ok = read_number<std::int8_t>(var); break;
+            case access_kind::int16:        ok = read_number<std::int16_t>(var); break;
+            case access_kind::int32:        ok = read_number<std::int32_t>(var); break;
+            case access_kind::int64:        ok = read_number<std::int64_t>(var); break;
+            case access_kind::uint8:        ok = read_number<std::uint8_t>(var); break;
+            case access_kind::uint16:       ok = read_number<std::uint16_t>(var); break;
+            case access_kind::uint32:       ok = read_number<std::uint32_t>(var); break;
+            case access_kind::uint64:       ok = read_number<std::uint64_t>(var); break;
+            case access_kind::float32:      ok = read_number<float>(var); break;
+            case access_kind::float64:      ok = read_number<double>(var); break;
+            case access_kind::enumeration:  return read_enumeration(var, t);
+            case access_kind::string:
+            {
+                std::string text;
+                if (!read_string(text))
+                    return false;
+
+                var = std::move(text);
+                return true;
+            }
+            case access_kind::other:
+            {
+                std::string text;
+                if (!read_string(text))
+                    return false;
+
+                var = std::move(text);
+                return var.convert(t);
+            }
+            default:
+                return false;
+        }
+
+        // e.g. the type 'long' is stored as 'int64_t', but both are different types
+        return (ok && (var.get_type() == t || var.convert(t)));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    /*!
+     * Reads into an existing value, i.e. containers, objects and objects behind a pointer or wrapper.
+     */
+    bool read_into(variant& var, access_kind kind, const type& t, const access_plan& plan)
+    {
+        switch (kind)
+        {
+            case access_kind::sequential_container:
+            {
+                auto view = var.create_sequential_view();
+                return read_sequential(view);
+            }
+            case access_kind::associative_container:
+            {
+                auto view = var.create_associative_view();
+                return read_associative(view);
+            }
+            case access_kind::object:
+            {
+                return read_object(get_object_instance(instance(var)), plan.is_valid() ? plan : access_plan::get(t));
+            }
+            case access_kind::pointer:
+            case access_kind::wrapper:
+            {
+                std::uint8_t flag;
+                if (!read_raw(flag))
+                    return false;
+
+                if (flag == 0)
+                    return true;
+
+                const instance obj = get_object_instance(instance(var));
+                const auto object_plan = plan.is_valid() ? plan : access_plan::get(obj.get_type());
+                if (obj.is_valid())
+                    return read_object(obj, object_plan);
+                else
+                    return skip_object();
+            }
+            default:
+                return false;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
+private:
+    template<typename T>
+    bool read_raw(T& value)
+    {
+        return read_bytes(&value, sizeof(T));
+    }
+
+    bool read_bytes(void* data, std::size_t size)
+    {
+        if (static_cast<std::size_t>(m_end - m_pos) < size)
+            return false;
+
+        std::memcpy(data, m_pos, size);
+        m_pos += size;
+        return true;
+    }
+
+    bool read_size(std::size_t& size)
+    {
+        std::uint32_t value;
+        if (!read_raw(value))
+            return false;
+
+        size = value;
+        return true;
+    }
+
+    bool read_string(std::string& text)
+    {
+        std::size_t size;
+        if (!read_size(size) || static_cast<std::size_t>(m_end - m_pos) < size)
+            return false;
+
+        text.assign(reinterpret_cast<const char*>(m_pos), size);
+        m_pos += size;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    bool read_entry(const instance& obj, const access_plan_entry& entry)
+    {
+        const auto& prop = entry.get_property();
+        const auto kind = entry.get_kind();
+        const bool writable = !prop.is_readonly();
+        if (is_number_kind(kind))
+        {
+            void* address = writable ? entry.get_member_address(obj) : nullptr;
+            if (address && kind == access_kind::boolean)
+            {
+                // not every byte value is a valid bool
+                std::uint8_t value;
+                if (!read_raw(value))
+                    return false;
+
+                *static_cast<bool*>(address) = (value != 0);
+                return true;
+            }
+            else if (address)
+            {
+                return read_bytes(address, entry.get_value_type().get_sizeof());
+            }
+        }
+        else if (kind == access_kind::string)
+        {
+            if (void* address = writable ? entry.get_member_address(obj) : nullptr)
+                return read_string(*static_cast<std::string*>(address));
+        }
+        else if (kind == access_kind::object)
+        {
+            instance member = writable ? entry.get_member(obj) : instance();
+            if (member.is_valid())
+                return read_object(member, entry.get_nested_plan());
+        }
+
+        if (!writable)
+            return true; // the value is skipped, every value is located by the offset table
+
+        variant value;
+        switch (kind)
+        {
+            case access_kind::sequential_container:
+            case access_kind::associative_container:
+            case access_kind::object:
+            case access_kind::pointer:
+            case access_kind::wrapper:
+            {
+                // the current value is updated, like the containers, nested objects or the object pointed to
+                value = prop.get_value(obj);
+                if (!value.is_valid())
+                    return true;
+
+                if (!read_into(value, kind, entry.get_value_type(), entry.get_nested_plan()))
+                    return false;
+
+                // pointers and wrappers modify the object in-place
+                if (kind == access_kind::pointer || kind == access_kind::wrapper)
+                    return true;
+
+                break;
+            }
+            default:
+            {
+                if (!read_value(value, kind, entry.get_value_type()))
+                    return false;
+                break;
+            }
+        }
+
+        prop.set_value(obj, value);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    template<typename T>
+    bool read_number(variant& var)
+    {
+        T value;
+        if (!read_raw(value))
+            return false;
+
+        var = value;
+        return true;
+    }
+
+    bool read_enumeration(variant& var, const type& t)
+    {
+        std::int64_t value = 0;
+        bool ok = false;
+        switch (t.get_sizeof())
+        {
+            case 1: { std::int8_t v;  ok = read_raw(v); value = v; break; }
+            case 2: { std::int16_t v; ok = read_raw(v); value = v; break; }
+            case 4: { std::int32_t v; ok = read_raw(v); value = v; break; }
+            case 8: { ok = read_raw(value); break; }
+            default: break;
+        }
+
+        if (!ok)
+            return false;
+
+        var = value;
+        return var.convert(t);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    bool skip_object()
+    {
+        std::size_t object_size;
+        if (!read_size(object_size) || object_size < sizeof(std::uint32_t) ||
+            object_size - sizeof(std::uint32_t) > static_cast<std::size_t>(m_end - m_pos))
+        {
+            return false;
+        }
+
+        m_pos += object_size - sizeof(std::uint32_t);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    bool read_sequential(variant_sequential_view& view)
+    {
+        std::size_t count;
+        if (!view.is_valid() || !read_size(count))
+            return false;
+
+        if (view.get_size() != count && !view.set_size(count))
+            return false;
+
+        const auto item_type = view.get_value_type();
+        const auto item_kind = access_plan::get_kind(item_type);
+        const auto item_plan = get_item_plan(item_type, item_kind);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (is_in_place_kind(item_kind))
+            {
+                // the item is a reference to the value inside the container, which is updated in-place
+                variant item = view.get_value(i);
+                if (!read_into(item, item_kind, item_type, item_plan))
+                    return false;
+            }
+            else
+            {
+                variant value;
+                if (!read_value(value, item_kind, item_type) || !view.set_value(i, value))
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    bool read_item(variant& var, const type& item_type, access_kind item_kind, const access_plan& item_plan)
+    {
+        if (!is_in_place_kind(item_kind))
+            return read_value(var, item_kind, item_type);
+
+        if (item_kind == access_kind::pointer || item_kind == access_kind::wrapper)
+            return false; // there is no object, which could be updated
+
+        // create a new value, which is updated afterwards
+        var = create_value(item_type);
+        return (var.is_valid() && read_into(var, item_kind, item_type, item_plan));
+    }
+
+    bool read_associative(variant_associative_view& view)
+    {
+        std::size_t count;
+        if (!view.is_valid() || !read_size(count))
+            return false;
+
+        view.clear();
+
+        const auto key_type = view.get_key_type();
+        const auto key_kind = access_plan::get_kind(key_type);
+        const auto key_plan = get_item_plan(key_type, key_kind);
+        const auto value_type = view.get_value_type();
+        const auto value_kind = access_plan::get_kind(value_type);
+        const auto value_plan = get_item_plan(value_type, value_kind);
+        const bool key_only = view.is_key_only_type();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            variant key;
+            if (!read_item(key, key_type, key_kind, key_plan))
+                return false;
+
+            if (key_only)
+            {
+                if (!view.insert(key).second)
+                    return false;
+            }
+            else
+            {
+                variant value;
+                if (!read_item(value, value_type, value_kind, value_plan) || !view.insert(key, value).second)
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+private:
+    const std::uint8_t* m_pos;
+    const std::uint8_t* m_end;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_BINARY_READER_P_H_
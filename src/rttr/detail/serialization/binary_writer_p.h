@@ -0,0 +1,337 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_BINARY_WRITER_P_H_
+#define RTTR_BINARY_WRITER_P_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include "rttr/detail/serialization/binary_format.h"
+#include "rttr/variant.h"
+#include "rttr/variant_sequential_view.h"
+#include "rttr/variant_associative_view.h"
+
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Writes objects in the binary format, see \ref binary_header.
+ */
+class RTTR_LOCAL binary_writer
+{
+public:
+    binary_writer(std::vector<std::uint8_t>& buffer) : m_buffer(buffer) {}
+
+    bool write(const instance& obj)
+    {
+        const auto plan = access_plan::get(obj.get_derived_type());
+        if (!plan.is_valid())
+            return false;
+
+        const auto header = make_binary_header(plan.get_fingerprint());
+        write_bytes(&header, sizeof(header));
+        return write_object(obj, plan);
+    }
+
+private:
+    template<typename T>
+    void write_raw(const T& value)
+    {
+        write_bytes(&value, sizeof(T));
+    }
+
+    void write_bytes(const void* data, std::size_t size)
+    {
+        const auto ptr = static_cast<const std::uint8_t*>(data);
+        m_buffer.insert(m_buffer.end(), ptr, ptr + size);
+    }
+
+    bool write_size(std::size_t size)
+    {
+        if (size > std::numeric_limits<std::uint32_t>::max())
+            return false;
+
+        write_raw(static_cast<std::uint32_t>(size));
+        return true;
+    }
+
+    bool write_string(const std::string& text)
+    {
+        if (!write_size(text.size()))
+            return false;
+
+        write_bytes(text.data(), text.size());
+        return true;
+    }
+
+    void patch_size(std::size_t pos, std::size_t value)
+    {
+        const auto size = static_cast<std::uint32_t>(value);
+        std::memcpy(&m_buffer[pos], &size, sizeof(size));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    bool write_object(const instance& obj, const access_plan& plan)
+    {
+        const auto entries = plan.get_entries();
+        const auto start = m_buffer.size();
+        const auto count = entries.size();
+        m_buffer.resize(start + binary_object_header_size + count * sizeof(std::uint32_t));
+        patch_size(start + sizeof(std::uint32_t), count);
+
+        std::size_t index = 0;
+        for (const auto& entry : entries)
+        {
+            const auto value_pos = m_buffer.size();
+            const auto result = write_entry(obj, entry);
+            if (result == write_result::failed)
+                return false;
+
+            if (result == write_result::written)
+                patch_size(start + binary_object_header_size + index * sizeof(std::uint32_t), value_pos - start);
+
+            ++index;
+        }
+
+        if (m_buffer.size() - start > std::numeric_limits<std::uint32_t>::max())
+            return false;
+
+        patch_size(start, m_buffer.size() - start);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    enum class write_result
+    {
+        written,
+        skipped,
+        failed
+    };
+
+    write_result write_entry(const instance& obj, const access_plan_entry& entry)
+    {
+        const auto kind = entry.get_kind();
+        if (is_number_kind(kind))
+        {
+            if (const void* address = entry.get_member_address(obj))
+            {
+                write_bytes(address, entry.get_value_type().get_sizeof());
+                return write_result::written;
+            }
+        }
+        else if (kind == access_kind::string)
+        {
+            if (const void* address = entry.get_member_address(obj))
+                return (write_string(*static_cast<const std::string*>(address)) ? write_result::written : write_result::failed);
+        }
+        else if (kind == access_kind::object)
+        {
+            instance member = entry.get_member(obj);
+            if (member.is_valid())
+                return (write_object(member, entry.get_nested_plan()) ? write_result::written : write_result::failed);
+        }
+
+        const variant value = entry.get_property().get_value(obj);
+        if (!value.is_valid())
+            return write_result::skipped;
+
+        return (write_value(value, kind, entry.get_value_type(), entry.get_nested_plan()) ? write_result::written : write_result::failed);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    bool write_number(const variant& var, access_kind kind, const type& t)
+    {
+        bool ok = false;
+        switch (kind)
+        {
+            case access_kind::boolean:  write_raw(var.to_bool()); return true;
+            case access_kind::character:
+            {
+                if (!var.is_type<char>())
+                    return false;
+                write_raw(var.get_value<char>());
+                return true;
+            }
+            case access_kind::int8:     write_raw(var.to_int8(&ok)); break;
+            case access_kind::int16:    write_raw(var.to_int16(&ok)); break;
+            case access_kind::int32:    write_raw(var.to_int32(&ok)); break;
+            case access_kind::int64:    write_raw(var.to_int64(&ok)); break;
+            case access_kind::uint8:    write_raw(var.to_uint8(&ok)); break;
+            case access_kind::uint16:   write_raw(var.to_uint16(&ok)); break;
+            case access_kind::uint32:   write_raw(var.to_uint32(&ok)); break;
+            case access_kind::uint64:   write_raw(var.to_uint64(&ok)); break;
+            case access_kind::float32:  write_raw(var.to_float(&ok)); break;
+            case access_kind::float64:  write_raw(var.to_double(&ok)); break;
+            case access_kind::enumeration:
+            {
+                // the enumeration is written with the size of its underlying type
+                const std::int64_t value = var.to_int64(&ok);
+                switch (t.get_sizeof())
+                {
+                    case 1: write_raw(static_cast<std::int8_t>(value)); break;
+                    case 2: write_raw(static_cast<std::int16_t>(value)); break;
+                    case 4: write_raw(static_cast<std::int32_t>(value)); break;
+                    case 8: write_raw(value); break;
+                    default: return false;
+                }
+                break;
+            }
+            default:
+                break;
+        }
+
+        return ok;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    bool write_value(const variant& var, access_kind kind, const type& t, const access_plan& plan)
+    {
+        if (is_number_kind(kind))
+            return write_number(var, kind, t);
+
+        switch (kind)
+        {
+            case access_kind::string:
+            {
+                return write_string(var.get_value<std::string>());
+            }
+            case access_kind::sequential_container:
+            {
+                return write_sequential(var.create_sequential_view());
+            }
+            case access_kind::associative_container:
+            {
+                return write_associative(var.create_associative_view());
+            }
+            case access_kind::object:
+            {
+                return write_object(get_object_instance(instance(var)), plan.is_valid() ? plan : access_plan::get(t));
+            }
+            case access_kind::pointer:
+            case access_kind::wrapper:
+            {
+                const instance obj = get_object_instance(instance(var));
+                const auto object_plan = plan.is_valid() ? plan : access_plan::get(obj.get_type());
+                if (!obj.is_valid() || !object_plan.is_valid() ||
+                    access_plan::get_kind(object_plan.get_type()) != access_kind::object)
+                {
+                    write_raw(std::uint8_t(0));
+                    return true;
+                }
+
+                write_raw(std::uint8_t(1));
+                return write_object(obj, object_plan);
+            }
+            default:
+            {
+                bool ok = false;
+                const auto text = var.to_string(&ok);
+                return (ok && write_string(text));
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    bool write_item(const variant& item, const type& item_type, access_kind item_kind, const access_plan& item_plan)
+    {
+        // the item is a reference to the value inside the container,
+        // objects and containers are accessed through this reference, without a copy
+        if (is_in_place_kind(item_kind))
+            return write_value(item, item_kind, item_type, item_plan);
+        else
+            return write_value(item.extract_wrapped_value(), item_kind, item_type, item_plan);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    bool write_sequential(const variant_sequential_view& view)
+    {
+        if (!view.is_valid() || !write_size(view.get_size()))
+            return false;
+
+        const auto item_type = view.get_value_type();
+        const auto item_kind = access_plan::get_kind(item_type);
+        const auto item_plan = get_item_plan(item_type, item_kind);
+        for (const auto& item : view)
+        {
+            if (!write_item(item, item_type, item_kind, item_plan))
+                return false;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
+    bool write_associative(const variant_associative_view& view)
+    {
+        if (!view.is_valid() || !write_size(view.get_size()))
+            return false;
+
+        const auto key_type = view.get_key_type();
+        const auto key_kind = access_plan::get_kind(key_type);
+        const auto key_plan = get_item_plan(key_type, key_kind);
+        const auto value_type = view.get_value_type();
+        const auto value_kind = access_plan::get_kind(value_type);
+        const auto value_plan = get_item_plan(value_type, value_kind);
+        const bool key_only = view.is_key_only_type();
+        for (const auto& item : view)
+        {
+            if (!write_item(item.first, key_type, key_kind, key_plan))
+                return false;
+
+            if (!key_only && !write_item(item.second, value_type, value_kind, value_plan))
+                return false;
+        }
+
+        return true;
+    }
+
+private:
+    std::vector<std::uint8_t>& m_buffer;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_BINARY_WRITER_P_H_
@@ -0,0 +1,560 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_JSON_READER_P_H_
+#define RTTR_JSON_READER_P_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include "rttr/detail/serialization/serialization_utility.h"
+#include "rttr/detail/conversion/number_conversion.h"
+#include "rttr/variant.h"
+#include "rttr/variant_sequential_view.h"
+#include "rttr/variant_associative_view.h"
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <string>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * The state of one JSON object or array, which is currently read.
+ */
+struct json_frame
+{
+    enum class frame_kind : std::uint8_t
+    {
+        object,         //!< A JSON object, which is read into the properties of an object.
+        sequential,     //!< A JSON array, which is read into a sequential container.
+        associative,    //!< A JSON array, which is read into an associative container.
+        key_value,      //!< A JSON object with the members "key" and "value", i.e. one item of an associative container.
+        skip            //!< A JSON object or array, which cannot be read and is ignored.
+    };
+
+    explicit json_frame(frame_kind kind) : m_kind(kind), m_in_place(true), m_entry(nullptr), m_index(0) {}
+
+    json_frame(const instance& obj, const access_plan& plan)
+    :   m_kind(frame_kind::object), m_in_place(true), m_object(obj), m_plan(plan), m_entry(nullptr), m_index(0)
+    {
+    }
+
+    /*!
+     * The frames are created inside of a deque, which does not move them, so \ref m_object can refer to \ref m_value.
+     */
+    json_frame(variant value, bool in_place)
+    :   m_kind(frame_kind::object), m_in_place(in_place), m_value(std::move(value)),
+        m_object(m_value.is_valid() ? get_object_instance(instance(m_value)) : instance()),
+        m_entry(nullptr), m_index(0)
+    {
+    }
+
+    frame_kind                  m_kind;
+    // when false, 'm_value' is a copy, which is passed to the parent frame at the end
+    bool                        m_in_place;
+    variant                     m_value;
+    instance                    m_object;
+    access_plan                 m_plan;
+    // the entry of the last key; nullptr, when the value of the key is ignored
+    const access_plan_entry*    m_entry;
+    variant                     m_key;
+    variant_sequential_view     m_sequential_view;
+    variant_associative_view    m_associative_view;
+    // sequential: the index of the next item; key_value: 0 = "key", 1 = "value", 2 = unknown member
+    std::size_t                 m_index;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Reads JSON into an object, driven by the events of a SAX parser.
+ *
+ * The reader keeps one \ref json_frame per open JSON object or array, i.e. its memory depends only on the nesting depth
+ * of the input, not on its size. Keys are resolved with \ref access_plan::find_entry(); numbers, booleans and strings
+ * of member object properties are written directly to the member, without creating a \ref variant.
+ *
+ * The layout is the same like the one of the JSON serialization example: objects are JSON objects,
+ * sequential containers JSON arrays and associative containers JSON arrays of keys or of objects with the members "key" and "value".
+ *
+ * \remark The member functions with uppercase names implement the handler concept of the SAX parser of RapidJSON.
+ */
+class RTTR_LOCAL json_reader
+{
+public:
+    using frame_kind = json_frame::frame_kind;
+
+    explicit json_reader(const instance& obj) : m_object(obj) {}
+
+    bool Null()
+    {
+        if (m_frames.empty())
+            return false;
+
+        // keep the position in arrays
+        auto& frame = m_frames.back();
+        if (frame.m_kind == frame_kind::sequential)
+            grow(frame, frame.m_index++);
+
+        return true;
+    }
+
+    bool Bool(bool value)
+    {
+        if (m_frames.empty())
+            return false;
+
+        auto& frame = m_frames.back();
+        if (frame.m_kind == frame_kind::object && frame.m_entry && frame.m_entry->get_kind() == access_kind::boolean)
+        {
+            if (void* address = get_member_address(frame))
+            {
+                *static_cast<bool*>(address) = value;
+                return true;
+            }
+        }
+
+        variant var = value;
+        pass_value(var);
+        return true;
+    }
+
+    bool Int(int value)                     { return read_number(value); }
+    bool Uint(unsigned value)               { return read_number(value); }
+    bool Int64(std::int64_t value)          { return read_number(value); }
+    bool Uint64(std::uint64_t value)        { return read_number(value); }
+    bool Double(double value)               { return read_number(value); }
+
+    bool RawNumber(const char* str, unsigned length, bool)
+    {
+        return String(str, length, true);
+    }
+
+    bool String(const char* str, unsigned length, bool)
+    {
+        if (m_frames.empty())
+            return false;
+
+        auto& frame = m_frames.back();
+        if (frame.m_kind == frame_kind::object && frame.m_entry && frame.m_entry->get_kind() == access_kind::string)
+        {
+            if (void* address = get_member_address(frame))
+            {
+                static_cast<std::string*>(address)->assign(str, length);
+                return true;
+            }
+        }
+
+        variant value = std::string(str, length);
+        pass_value(value);
+        return true;
+    }
+
+    bool Key(const char* str, unsigned length, bool)
+    {
+        auto& frame = m_frames.back();
+        const string_view name(str, length);
+        if (frame.m_kind == frame_kind::object)
+            frame.m_entry = frame.m_plan.find_entry(name);
+        else if (frame.m_kind == frame_kind::key_value)
+            frame.m_index = (name == "key" ? 0 : (name == "value" ? 1 : 2));
+
+        return true;
+    }
+
+    bool StartObject()
+    {
+        if (m_frames.empty())
+        {
+            // the root has to be an object
+            if (m_done)
+                return false;
+
+            const auto obj = get_object_instance(m_object);
+            m_frames.emplace_back(obj, access_plan::get(obj.get_derived_type().get_raw_type()));
+            m_done = true;
+            return m_frames.back().m_plan.is_valid();
+        }
+
+        auto& parent = m_frames.back();
+        switch (parent.m_kind)
+        {
+            case frame_kind::object:
+            {
+                const auto entry = parent.m_entry;
+                if (!entry || entry->get_property().is_readonly())
+                    break;
+
+                const auto kind = entry->get_kind();
+                if (kind == access_kind::object)
+                {
+                    const instance member = entry->get_member(parent.m_object);
+                    if (member.is_valid())
+                    {
+                        m_frames.emplace_back(member, entry->get_nested_plan());
+                        return true;
+                    }
+
+                    // the value is copied, updated and set afterwards
+                    auto& frame = push_value(entry->get_property().get_value(parent.m_object), false);
+                    return set_object(frame, entry->get_nested_plan());
+                }
+                else if (kind == access_kind::pointer || kind == access_kind::wrapper)
+                {
+                    // the object pointed to is updated in-place
+                    auto& frame = push_value(entry->get_property().get_value(parent.m_object), true);
+                    return set_object(frame, entry->get_nested_plan());
+                }
+                break;
+            }
+            case frame_kind::sequential:
+            {
+                const auto index = parent.m_index++;
+                const auto item_type = parent.m_sequential_view.get_value_type();
+                const auto item_kind = access_plan::get_kind(item_type);
+                if ((item_kind == access_kind::object || item_kind == access_kind::pointer || item_kind == access_kind::wrapper) &&
+                    grow(parent, index))
+                {
+                    // the item is a reference to the value inside the container
+                    auto& frame = push_value(parent.m_sequential_view.get_value(index), true);
+                    return set_object(frame, get_item_plan(item_type, item_kind));
+                }
+                break;
+            }
+            case frame_kind::associative:
+            {
+                if (parent.m_associative_view.is_key_only_type())
+                    break;
+
+                m_frames.emplace_back(frame_kind::key_value);
+                return true;
+            }
+            case frame_kind::key_value:
+            {
+                if (parent.m_index > 1)
+                    break;
+
+                // keys and values are created and inserted when the item is complete
+                const auto& view = get_parent().m_associative_view;
+                const auto t = (parent.m_index == 0 ? view.get_key_type() : view.get_value_type());
+                if (access_plan::get_kind(t) != access_kind::object)
+                    break;
+
+                auto& frame = push_value(create_value(t), false);
+                return set_object(frame, access_plan::get(t));
+            }
+            case frame_kind::skip:
+            {
+                break;
+            }
+        }
+
+        m_frames.emplace_back(frame_kind::skip);
+        return true;
+    }
+
+    bool EndObject(unsigned)
+    {
+        return end_frame();
+    }
+
+    bool StartArray()
+    {
+        if (m_frames.empty())
+            return false;
+
+        auto& parent = m_frames.back();
+        if (parent.m_kind == frame_kind::object)
+        {
+            const auto entry = parent.m_entry;
+            const auto kind = (entry ? entry->get_kind() : access_kind::other);
+            if ((kind == access_kind::sequential_container || kind == access_kind::associative_container) &&
+                !entry->get_property().is_readonly())
+            {
+                // the container is copied, updated and set afterwards
+                auto& frame = push_value(entry->get_property().get_value(parent.m_object), false);
+                return set_container(frame, kind);
+            }
+        }
+        else if (parent.m_kind == frame_kind::sequential)
+        {
+            const auto index = parent.m_index++;
+            const auto item_kind = access_plan::get_kind(parent.m_sequential_view.get_value_type());
+            if ((item_kind == access_kind::sequential_container || item_kind == access_kind::associative_container) &&
+                grow(parent, index))
+            {
+                // the item is a reference to the container inside the container
+                auto& frame = push_value(parent.m_sequential_view.get_value(index), true);
+                return set_container(frame, item_kind);
+            }
+        }
+
+        m_frames.emplace_back(frame_kind::skip);
+        return true;
+    }
+
+    bool EndArray(unsigned)
+    {
+        return end_frame();
+    }
+
+    /*!
+     * Returns true, when the root object was read completely.
+     */
+    bool is_done() const { return (m_done && m_frames.empty()); }
+
+private:
+    /*!
+     * Returns the parent of the last frame.
+     */
+    json_frame& get_parent()
+    {
+        return m_frames[m_frames.size() - 2];
+    }
+
+    json_frame& push_value(variant value, bool in_place)
+    {
+        m_frames.emplace_back(std::move(value), in_place);
+        return m_frames.back();
+    }
+
+    /*!
+     * Prepares \p frame to read the object in its value; the frame is ignored, when there is no object, e.g. a null pointer.
+     */
+    bool set_object(json_frame& frame, const access_plan& plan)
+    {
+        if (!frame.m_object.is_valid())
+        {
+            frame.m_kind = frame_kind::skip;
+            frame.m_in_place = true;
+            return true;
+        }
+
+        // a pointer can point to an object of a derived type
+        const auto object_type = frame.m_object.get_derived_type().get_raw_type();
+        frame.m_plan = (plan.is_valid() && plan.get_type() == object_type) ? plan : access_plan::get(object_type);
+        return true;
+    }
+
+    bool set_container(json_frame& frame, access_kind kind)
+    {
+        if (kind == access_kind::sequential_container)
+        {
+            frame.m_kind = frame_kind::sequential;
+            frame.m_sequential_view = frame.m_value.create_sequential_view();
+            if (frame.m_sequential_view.is_valid())
+                return true;
+        }
+        else
+        {
+            frame.m_kind = frame_kind::associative;
+            frame.m_associative_view = frame.m_value.create_associative_view();
+            if (frame.m_associative_view.is_valid())
+            {
+                frame.m_associative_view.clear();
+                return true;
+            }
+        }
+
+        frame.m_kind = frame_kind::skip;
+        frame.m_in_place = true;
+        return true;
+    }
+
+    bool end_frame()
+    {
+        auto& frame = m_frames.back();
+        if (frame.m_kind == frame_kind::sequential && frame.m_index < frame.m_sequential_view.get_size())
+        {
+            // the array is shorter than the container; a failure is ignored for containers with a fixed size
+            frame.m_sequential_view.set_size(frame.m_index);
+        }
+        else if (frame.m_kind == frame_kind::key_value && frame.m_key.is_valid() && frame.m_value.is_valid())
+        {
+            get_parent().m_associative_view.insert(frame.m_key, frame.m_value);
+        }
+
+        if (frame.m_in_place)
+        {
+            m_frames.pop_back();
+            return true;
+        }
+
+        variant value = std::move(frame.m_value);
+        m_frames.pop_back();
+        pass_value(value);
+        return true;
+    }
+
+    /*!
+     * Grows the sequential container of \p frame, so it contains the item at \p index.
+     */
+    static bool grow(json_frame& frame, std::size_t index)
+    {
+        return (index < frame.m_sequential_view.get_size() || frame.m_sequential_view.set_size(index + 1));
+    }
+
+    static bool convert(variant& value, const type& t)
+    {
+        return (value.get_type() == t || value.convert(t));
+    }
+
+    static void* get_member_address(const json_frame& frame)
+    {
+        return (frame.m_entry->get_property().is_readonly() ? nullptr : frame.m_entry->get_member_address(frame.m_object));
+    }
+
+    /*!
+     * Passes a completely read \p value to the last frame.
+     */
+    void pass_value(variant& value)
+    {
+        auto& frame = m_frames.back();
+        switch (frame.m_kind)
+        {
+            case frame_kind::object:
+            {
+                if (!frame.m_entry)
+                    break;
+
+                const auto& prop = frame.m_entry->get_property();
+                if (!prop.is_readonly() && convert(value, frame.m_entry->get_value_type()))
+                    prop.set_value(frame.m_object, value);
+                break;
+            }
+            case frame_kind::sequential:
+            {
+                const auto index = frame.m_index++;
+                if (grow(frame, index) && convert(value, frame.m_sequential_view.get_value_type()))
+                    frame.m_sequential_view.set_value(index, value);
+                break;
+            }
+            case frame_kind::associative:
+            {
+                if (convert(value, frame.m_associative_view.get_key_type()))
+                    frame.m_associative_view.insert(value);
+                break;
+            }
+            case frame_kind::key_value:
+            {
+                const auto& view = get_parent().m_associative_view;
+                if (frame.m_index == 0 && convert(value, view.get_key_type()))
+                    frame.m_key = std::move(value);
+                else if (frame.m_index == 1 && convert(value, view.get_value_type()))
+                    frame.m_value = std::move(value);
+                break;
+            }
+            case frame_kind::skip:
+            {
+                break;
+            }
+        }
+    }
+
+    template<typename T>
+    bool read_number(T value)
+    {
+        if (m_frames.empty())
+            return false;
+
+        auto& frame = m_frames.back();
+        if (frame.m_kind == frame_kind::object && frame.m_entry)
+        {
+            const auto kind = frame.m_entry->get_kind();
+            if (kind > access_kind::boolean && kind <= access_kind::float64)
+            {
+                // a value, which is out of range, is ignored
+                if (void* address = get_member_address(frame))
+                {
+                    write_number(address, kind, value);
+                    return true;
+                }
+            }
+        }
+
+        variant var = value;
+        pass_value(var);
+        return true;
+    }
+
+    template<typename T>
+    static bool write_number(void* address, access_kind kind, const T& value)
+    {
+        switch (kind)
+        {
+            case access_kind::character:    return write_integer<char>(address, value);
+            case access_kind::int8:         return write_integer<std::int8_t>(address, value);
+            case access_kind::int16:        return write_integer<std::int16_t>(address, value);
+            case access_kind::int32:        return write_integer<std::int32_t>(address, value);
+            case access_kind::int64:        return write_integer<std::int64_t>(address, value);
+            case access_kind::uint8:        return write_integer<std::uint8_t>(address, value);
+            case access_kind::uint16:       return write_integer<std::uint16_t>(address, value);
+            case access_kind::uint32:       return write_integer<std::uint32_t>(address, value);
+            case access_kind::uint64:       return write_integer<std::uint64_t>(address, value);
+            case access_kind::float32:      return write_float<float>(address, value);
+            case access_kind::float64:      return write_float<double>(address, value);
+            default:                        return false;
+        }
+    }
+
+    template<typename T, typename F>
+    static bool write_integer(void* address, const F& from)
+    {
+        T value;
+        if (!convert_to(from, value))
+            return false;
+
+        std::memcpy(address, &value, sizeof(T));
+        return true;
+    }
+
+    template<typename T, typename F>
+    static bool write_float(void* address, const F& from)
+    {
+        const T value = static_cast<T>(from);
+        std::memcpy(address, &value, sizeof(T));
+        return true;
+    }
+
+private:
+    instance                m_object;
+    // a deque does not move its items, so references to the values of the frames stay valid
+    std::deque<json_frame>  m_frames;
+    bool                    m_done = false;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_JSON_READER_P_H_
@@ -0,0 +1,107 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_SERIALIZATION_UTILITY_H_
+#define RTTR_SERIALIZATION_UTILITY_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include "rttr/type.h"
+#include "rttr/instance.h"
+#include "rttr/variant.h"
+#include "rttr/constructor.h"
+#include "rttr/access_plan.h"
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE bool is_number_kind(access_kind kind) RTTR_NOEXCEPT
+{
+    return (kind <= access_kind::float64 || kind == access_kind::enumeration);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_INLINE instance get_object_instance(const instance& obj) RTTR_NOEXCEPT
+{
+    return (obj.get_type().get_raw_type().is_wrapper() ? obj.get_wrapped_instance() : obj);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Containers, objects and objects behind a pointer or wrapper are read by updating the existing value.
+ */
+RTTR_INLINE bool is_in_place_kind(access_kind kind) RTTR_NOEXCEPT
+{
+    return (kind == access_kind::sequential_container || kind == access_kind::associative_container ||
+            kind == access_kind::object || kind == access_kind::pointer || kind == access_kind::wrapper);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Returns the plan for the items of a container.
+ */
+RTTR_INLINE access_plan get_item_plan(const type& item_type, access_kind item_kind)
+{
+    switch (item_kind)
+    {
+        case access_kind::object:   return access_plan::get(item_type);
+        case access_kind::pointer:  return access_plan::get(item_type.get_raw_type());
+        case access_kind::wrapper:  return access_plan::get(item_type.get_wrapped_type().get_raw_type());
+        default:                    return access_plan();
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * Creates a new value of type \p t with its default constructor.
+ * Only constructors, which create the object by value, are used; see \ref policy::ctor::as_object.
+ */
+RTTR_INLINE variant create_value(const type& t)
+{
+    for (const auto& ctor : t.get_constructors())
+    {
+        if (ctor.get_parameter_infos().empty() && ctor.get_instantiated_type() == t)
+            return ctor.invoke();
+    }
+
+    return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+} // end namespace rttr
+
+#endif // RTTR_SERIALIZATION_UTILITY_H_
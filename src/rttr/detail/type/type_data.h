@@ -137,6 +137,7 @@ struct RTTR_LOCAL type_data
     string_view type_name;
 
     std::size_t get_sizeof;
+    std::size_t get_alignof;
     std::size_t get_pointer_dimension;
 
     impl::create_variant_func create_variant;
@@ -181,6 +182,28 @@ struct RTTR_LOCAL get_size_of<T, enable_if_t<std::is_same<T, void>::value || std
     }
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, typename Enable = void>
+struct RTTR_LOCAL get_align_of
+{
+    RTTR_INLINE RTTR_CONSTEXPR static std::size_t value()
+    {
+        return alignof(T);
+    }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+struct RTTR_LOCAL get_align_of<T, enable_if_t<std::is_same<T, void>::value || std::is_function<T>::value>>
+{
+    RTTR_INLINE RTTR_CONSTEXPR static std::size_t value()
+    {
+        return 0;
+    }
+};
+
 /////////////////////////////////////////////////////////////////////////////////
 
 template<typename T, bool = std::is_same<T, typename raw_type<T>::type >::value>
@@ -307,6 +330,7 @@ RTTR_LOCAL std::unique_ptr<type_data> make_type_data()
                             ::rttr::detail::get_type_name<T>().to_string(), ::rttr::detail::get_type_name<T>(),
 
                             get_size_of<T>::value(),
+                            get_align_of<T>::value(),
                             pointer_count<T>::value,
 
                             &create_variant_func<T>::create_variant,
@@ -260,7 +260,8 @@ void type_register::register_base_class(const type& derived_type, const base_cla
 
 type_register_private::type_register_private()
 :   m_type_list({ type(get_invalid_type_data()) }),
-    m_type_data_storage({ get_invalid_type_data() })
+    m_type_data_storage({ get_invalid_type_data() }),
+    m_registration_version(0)
 {
 }
 
@@ -629,6 +630,7 @@ void type_register_private::unregister_type(type_data* info) RTTR_NOEXCEPT
         remove_base_types_from_derived_classes(obj_t, info->m_class_data.m_derived_types);
         m_orig_name_to_id.erase(info->type_name);
         m_custom_name_to_id.erase(info->name);
+        ++m_registration_version;
     }
 }
 
@@ -785,6 +787,7 @@ bool type_register_private::register_property(const property_wrapper_base* prop)
     auto p = detail::create_item<::rttr::property>(prop);
     property_list.emplace_back(p);
     update_class_list(t, &class_data::m_properties);
+    ++m_registration_version;
     return true;
 }
 
@@ -1094,6 +1097,13 @@ variant type_register_private::get_metadata(const variant& key, const std::vecto
 
 /////////////////////////////////////////////////////////////////////////////////////
 
+std::size_t type_register_private::get_registration_version() const RTTR_NOEXCEPT
+{
+    return m_registration_version;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////
+
 std::vector<type_data*>& type_register_private::get_type_data_storage()
 {
     return m_type_data_storage;
@@ -37,6 +37,7 @@
 
 #include "rttr/string_view.h"
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
@@ -127,6 +128,14 @@ public:
     static variant get_metadata(const variant& key, const std::vector<metadata>& data);
     /////////////////////////////////////////////////////////////////////////////////////
 
+    /*!
+     * Returns a number, which changes every time when properties are registered or types are unregistered.
+     * It is used to invalidate data which is derived from the registered class items, e.g. an \ref access_plan.
+     */
+    std::size_t get_registration_version() const RTTR_NOEXCEPT;
+
+    /////////////////////////////////////////////////////////////////////////////////////
+
     static type_register_private& get_instance();
 
 private:
@@ -228,6 +237,7 @@ private:
     std::vector<data_container<const type_comparator_base*>>    m_type_less_than_cmp_list;
 
     std::mutex                                                  m_mutex;
+    std::atomic<std::size_t>                                    m_registration_version;
 };
 
 } // end namespace detail
@@ -48,6 +48,7 @@ class RTTR_LOCAL variant_sequential_view_private
         :   m_type(get_invalid_type()),
             m_value_type(get_invalid_type()),
             m_container(nullptr),
+            m_is_const_container(true),
             m_get_is_empty_func(sequential_container_empty::is_empty),
             m_get_size_func(sequential_container_empty::get_size),
             m_set_size_func(sequential_container_empty::set_size),
@@ -74,6 +75,7 @@ class RTTR_LOCAL variant_sequential_view_private
             :   m_type(type::get<RawType>()),
             m_value_type(type::get<typename sequential_container_mapper<RawType>::value_t>()),
             m_container(as_void_ptr(container)),
+            m_is_const_container(std::is_const<ConstType>::value),
             m_get_is_empty_func(sequential_container_mapper_wrapper<RawType, ConstType>::is_empty),
             m_get_size_func(sequential_container_mapper_wrapper<RawType, ConstType>::get_size),
             m_set_size_func(sequential_container_mapper_wrapper<RawType, ConstType>::set_size),
@@ -112,6 +114,22 @@ class RTTR_LOCAL variant_sequential_view_private
             return m_value_type;
         }
 
+        /*!
+         * Returns the address of the container itself, which is of type \ref get_type().
+         */
+        RTTR_INLINE void* get_container() const RTTR_NOEXCEPT
+        {
+            return m_container;
+        }
+
+        /*!
+         * Returns true, when the container cannot be modified through this view.
+         */
+        RTTR_INLINE bool is_const_container() const RTTR_NOEXCEPT
+        {
+            return m_is_const_container;
+        }
+
         RTTR_INLINE void copy(iterator_data& itr_tgt, const iterator_data& itr_src) const
         {
             m_create_func(itr_tgt, itr_src);
@@ -228,6 +246,7 @@ class RTTR_LOCAL variant_sequential_view_private
         type                    m_type;
         type                    m_value_type;
         void*                   m_container;
+        bool                    m_is_const_container;
         get_is_empty_func       m_get_is_empty_func;
         get_size_func           m_get_size_func;
         set_size_func           m_set_size_func;
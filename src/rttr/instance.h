@@ -38,6 +38,11 @@ class variant;
 class type;
 class argument;
 
+namespace detail
+{
+class access_plan_private;
+} // end namespace detail
+
 /*!
  * The \ref instance class is used for forwarding the instance of an object to invoke a \ref property or \ref method.
  *
@@ -147,6 +152,8 @@ public:
     RTTR_INLINE type get_derived_type() const RTTR_NOEXCEPT;
 
 private:
+    friend class detail::access_plan_private;
+
     instance& operator=(const instance& other) RTTR_NOEXCEPT;
 
     detail::data_address_container m_data_container;
@@ -0,0 +1,148 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/json_serialization.h"
+#include "rttr/detail/serialization/json_reader_p.h"
+
+#include <rapidjson/reader.h>
+#include <rapidjson/memorystream.h>
+
+#include <istream>
+
+namespace rttr
+{
+namespace detail
+{
+
+namespace
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+/*!
+ * An input stream for the parser of RapidJSON, which reads a `std::istream` in chunks of a fixed size.
+ */
+class istream_read_stream
+{
+public:
+    using Ch = char;
+
+    explicit istream_read_stream(std::istream& stream)
+    :   m_stream(stream),
+        m_current(m_buffer),
+        m_last(m_buffer),
+        m_count(0),
+        m_read_count(0),
+        m_eof(false)
+    {
+        read();
+    }
+
+    Ch Peek() const { return *m_current; }
+    Ch Take() { const Ch c = *m_current; read(); return c; }
+    std::size_t Tell() const { return (m_count + static_cast<std::size_t>(m_current - m_buffer)); }
+
+    // only needed for in-situ parsing, which is not used
+    void Put(Ch) {}
+    void Flush() {}
+    Ch* PutBegin() { return nullptr; }
+    std::size_t PutEnd(Ch*) { return 0; }
+
+private:
+    void read()
+    {
+        if (m_current < m_last)
+        {
+            ++m_current;
+        }
+        else if (!m_eof)
+        {
+            m_count += m_read_count;
+            m_stream.read(m_buffer, sizeof(m_buffer) - 1);
+            m_read_count = static_cast<std::size_t>(m_stream.gcount());
+            m_current = m_buffer;
+            // the parser stops at the terminating null character
+            m_buffer[m_read_count] = '\0';
+            m_last = m_buffer + m_read_count;
+            if (m_read_count == 0)
+                m_eof = true;
+            else
+                --m_last;
+        }
+    }
+
+private:
+    std::istream&   m_stream;
+    Ch              m_buffer[4096];
+    Ch*             m_current;
+    Ch*             m_last;
+    std::size_t     m_count;
+    std::size_t     m_read_count;
+    bool            m_eof;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename Stream>
+bool read_json(Stream& stream, const instance& obj)
+{
+    json_reader handler(obj);
+    rapidjson::Reader reader;
+    const auto result = reader.Parse(stream, handler);
+    return (!result.IsError() && handler.is_done());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace anonymous
+} // end namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool from_json(string_view json, instance obj)
+{
+    if (!obj.is_valid())
+        return false;
+
+    rapidjson::MemoryStream stream(json.data(), json.size());
+    return detail::read_json(stream, obj);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool from_json(std::istream& stream, instance obj)
+{
+    if (!obj.is_valid())
+        return false;
+
+    detail::istream_read_stream json_stream(stream);
+    return detail::read_json(json_stream, obj);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
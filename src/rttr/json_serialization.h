@@ -0,0 +1,76 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_JSON_SERIALIZATION_H_
+#define RTTR_JSON_SERIALIZATION_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include "rttr/type.h"
+#include "rttr/instance.h"
+#include "rttr/string_view.h"
+
+#include <iosfwd>
+
+namespace rttr
+{
+
+/*!
+ * \brief Reads the JSON text \p json into the object \p obj.
+ *
+ * The JSON is parsed as a stream of events, no document tree is created; every key of a JSON object is resolved
+ * to the \ref property of the same name with \ref access_plan::find_entry() and its value is written directly into \p obj.
+ * The memory needed depends only on the nesting depth of the JSON, not on its size.
+ *
+ * The layout is the same like in the JSON serialization example:
+ * - objects are JSON objects with one member per property
+ * - sequential containers are JSON arrays; the container is resized to the length of the array
+ * - associative containers are JSON arrays; either of the keys or of JSON objects with the members "key" and "value"
+ * - enumerations are the names of their values or numbers
+ *
+ * Nested objects, containers and objects pointed to are updated in-place; null pointers are not followed.
+ * Members of unknown properties, read only properties and values, which cannot be converted to the type of the property, are ignored.
+ * Objects, which are stored as key or value of an associative container, are created with their default constructor;
+ * it has to be registered with the policy \ref policy::ctor::as_object.
+ *
+ * \return True, when the JSON text is valid and its root is an object; otherwise false.
+ *         When the JSON is invalid, the values read so far are kept.
+ */
+RTTR_API bool from_json(string_view json, instance obj);
+
+/*!
+ * \brief Reads the JSON text in \p stream into the object \p obj.
+ *
+ * Same as \ref from_json(string_view, instance), but the text is read from \p stream in chunks of a fixed size.
+ *
+ * \return True, when the JSON text is valid and its root is an object; otherwise false.
+ */
+RTTR_API bool from_json(std::istream& stream, instance obj);
+
+} // end namespace rttr
+
+#endif // RTTR_JSON_SERIALIZATION_H_
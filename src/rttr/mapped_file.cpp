@@ -0,0 +1,98 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/mapped_file.h"
+#include "rttr/detail/mapped_file/mapped_file_p.h"
+
+namespace rttr
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+mapped_file::mapped_file(string_view file_name)
+:   m_file(new detail::mapped_file_private(file_name))
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+mapped_file::~mapped_file()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool mapped_file::open()
+{
+    return m_file->open();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool mapped_file::close()
+{
+    return m_file->close();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool mapped_file::is_open() const RTTR_NOEXCEPT
+{
+    return m_file->is_open();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+const std::uint8_t* mapped_file::get_data() const RTTR_NOEXCEPT
+{
+    return m_file->get_data();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t mapped_file::get_size() const RTTR_NOEXCEPT
+{
+    return m_file->get_size();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+string_view mapped_file::get_file_name() const RTTR_NOEXCEPT
+{
+    return m_file->get_file_name();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+string_view mapped_file::get_error_string() const RTTR_NOEXCEPT
+{
+    return m_file->get_error_string();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
@@ -0,0 +1,141 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_MAPPED_FILE_H_
+#define RTTR_MAPPED_FILE_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+#include "rttr/string_view.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace rttr
+{
+namespace detail
+{
+class mapped_file_private;
+} // end namespace detail
+
+/*!
+ * The \ref mapped_file class maps the content of a file read-only into memory.
+ *
+ * The content is not read up front; the operating system loads the pages of the file, when they are accessed.
+ * Together with a \ref binary_view, the data written by \ref to_binary() can be accessed directly from the file,
+ * without deserializing it first.
+ *
+ * Typical Usage
+ * ----------------------
+ *
+ * \code{.cpp}
+ *   mapped_file file("assets.bin");
+ *   if (file.open())
+ *   {
+ *      binary_view view(file.get_data(), file.get_size(), type::get<asset_list>());
+ *      string_view name = view.get_string("name");
+ *   }
+ * \endcode
+ *
+ * \remark The data is only valid as long as the file is \ref is_open() "open".
+ */
+class RTTR_API mapped_file
+{
+public:
+    /*!
+     * \brief Constructs a mapped_file instance for the given file \p file_name.
+     *        The file name is expected to be encoded in UTF-8 format.
+     *
+     * \remark The file is not opened, call \ref open() for this.
+     */
+    mapped_file(string_view file_name);
+
+    /*!
+     * \brief Destroys the mapped_file instance and \ref close() "closes" the file.
+     */
+    ~mapped_file();
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    /*!
+     * \brief Opens the file and maps its content into memory.
+     *        When the file could not be opened, check the \ref get_error_string() "error string".
+     *
+     * \return `true` when the file was successfully opened or is already open; otherwise `false`.
+     */
+    bool open();
+
+    /*!
+     * \brief Closes the file; the data returned by \ref get_data() is no longer valid afterwards.
+     *
+     * \return `true` when the file was closed; otherwise `false`, e.g. when it was not open.
+     */
+    bool close();
+
+    /*!
+     * \brief Returns true, when the file is open; otherwise false.
+     *
+     * \return `true` when the file is open; otherwise `false`.
+     */
+    bool is_open() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns the content of the file; or `nullptr` when the file is not open or empty.
+     *
+     * \return The address of the mapped content.
+     */
+    const std::uint8_t* get_data() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns the size of the file in bytes; or zero when the file is not open.
+     *
+     * \return The size of the mapped content.
+     */
+    std::size_t get_size() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns the file name, which was given in the constructor.
+     *
+     * \return The file name of this instance.
+     */
+    string_view get_file_name() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief When the file could not be opened or closed, the error string will contain the reason.
+     *
+     * \return A string containing the error; otherwise an empty string.
+     */
+    string_view get_error_string() const RTTR_NOEXCEPT;
+
+private:
+    std::unique_ptr<detail::mapped_file_private> m_file;
+};
+
+} // end namespace rttr
+
+#endif // RTTR_MAPPED_FILE_H_
@@ -187,7 +187,21 @@ variant method::invoke(instance object, argument arg1, argument arg2, argument a
 
 variant method::invoke_variadic(instance object, std::vector<argument> args) const
 {
-    return m_wrapper->invoke_variadic(object, args);
+    return invoke_variadic(object, args.data(), args.size());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant method::invoke_variadic(instance object, const argument* args, std::size_t arg_count) const
+{
+    return m_wrapper->invoke_variadic(object, args, arg_count);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+detail::typed_thunk method::get_typed_thunk(string_view signature) const RTTR_NOEXCEPT
+{
+    return m_wrapper->get_typed_thunk(signature);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
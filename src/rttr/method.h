@@ -34,6 +34,7 @@
 #include "rttr/access_levels.h"
 #include "rttr/array_range.h"
 #include "rttr/string_view.h"
+#include "rttr/typed_invoker.h"
 
 #include <string>
 #include <vector>
@@ -51,6 +52,7 @@ class visitor;
 namespace detail
 {
     class method_wrapper_base;
+    struct typed_thunk;
 }
 
 /*!
@@ -88,6 +90,9 @@ namespace detail
  *
  * Another way to invoke a method is to use the \ref type class through \ref type::invoke().
  *
+ * When the signature of the method is known at compile time, use \ref get_invoker() to retrieve a \ref typed_invoker.
+ * It validates the signature only once and calls afterwards the underlying function directly, without any \ref argument or \ref variant objects.
+ *
  * Copying and Assignment
  * ----------------------
  * A \ref method object is lightweight and can be copied by value. However, each copy will refer to the same underlying method.
@@ -323,6 +328,47 @@ class RTTR_API method
          */
         variant invoke_variadic(instance object, std::vector<argument> args) const;
 
+        /*!
+         * \brief Invokes the method represented by the current instance \p object, using the \p arg_count
+         *        arguments stored in the array \p args.
+         *
+         * In contrast to the overload with a `std::vector`, the arguments are not copied.
+         * So the caller can provide them e.g. as array on the stack, which avoids any heap allocation.
+         *
+         * \code{.cpp}
+         *  int value_1 = 23;
+         *  std::string value_2 = "text";
+         *  argument args[] = {value_1, value_2};
+         *  variant ret = meth.invoke_variadic(obj, args, 2);
+         * \endcode
+         *
+         * \remark The given argument type has to match **exactly** the type of the underling method parameter,
+         *         otherwise the method cannot be invoked and an invalid \ref variant object (see \ref variant::is_valid)
+         *         will be returned.
+         *         The arguments have to stay valid until this function returns.
+         *
+         * \see get_parameter_infos()
+         *
+         * \return The possible return value of the method.
+         */
+        variant invoke_variadic(instance object, const argument* args, std::size_t arg_count) const;
+
+        /*!
+         * \brief Returns a \ref typed_invoker, which calls the underlying function of this method directly.
+         *
+         * The given \p Signature has to match **exactly** the signature of the registered function.
+         * For member functions the first argument is a reference to the object, e.g. `int(MyStruct&, int)`
+         * or `int(const MyStruct&, int)` for const member functions.
+         *
+         * \remark When the signature does not match or the method is not valid, an invalid invoker will be returned.
+         *
+         * \see typed_invoker
+         *
+         * \return A typed invoker for the given signature.
+         */
+        template<typename Signature>
+        typed_invoker<Signature> get_invoker() const RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns true if this method is the same like the \p other.
          *
@@ -342,6 +388,8 @@ class RTTR_API method
 
         void visit(visitor& visitor) const RTTR_NOEXCEPT;
 
+        detail::typed_thunk get_typed_thunk(string_view signature) const RTTR_NOEXCEPT;
+
         template<typename T>
         friend T detail::create_item(const detail::class_item_to_wrapper_t<T>* wrapper);
         template<typename T>
@@ -354,4 +402,6 @@ class RTTR_API method
 
 } // end namespace rttr
 
+#include "rttr/detail/impl/method_impl.h"
+
 #endif // RTTR_METHOD_H_
@@ -0,0 +1,521 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include "rttr/object_pool.h"
+#include "rttr/detail/object_pool/object_pool_p.h"
+#include "rttr/detail/misc/utility.h"
+#include "rttr/parameter_info.h"
+
+#include <algorithm>
+#include <new>
+#include <unordered_map>
+
+namespace rttr
+{
+namespace detail
+{
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+/*!
+ * The magazine of one pool in the cache of a thread.
+ * The storage is referenced weakly, so the pool can be destroyed independently of the thread.
+ */
+struct pool_magazine_entry
+{
+    std::weak_ptr<pool_storage> m_storage;
+    pool_magazine               m_magazine;
+};
+
+/*!
+ * Holds the magazines of the current thread, for all pools.
+ * The pools are identified by an unique id instead of their address,
+ * so a magazine of an already destroyed pool can never be used by a new pool.
+ * When the thread terminates, all cached slots are given back to their pools.
+ */
+struct pool_magazine_cache
+{
+    ~pool_magazine_cache()
+    {
+        for (auto& item : m_magazines)
+        {
+            if (auto storage = item.second.m_storage.lock())
+                storage->push_magazine(item.second.m_magazine);
+        }
+    }
+
+    std::uint64_t                                           m_last_id = 0;
+    pool_magazine*                                          m_last_magazine = nullptr;
+    std::unordered_map<std::uint64_t, pool_magazine_entry>  m_magazines;
+};
+
+pool_magazine_cache& get_magazine_cache()
+{
+    static thread_local pool_magazine_cache cache;
+    return cache;
+}
+
+std::uint64_t create_pool_id()
+{
+    static std::atomic<std::uint64_t> next_id(1);
+    return next_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+/*!
+ * Cuts the first \p count slots from the chain \p first and returns the remaining chain.
+ */
+pool_slot* split_chain(pool_slot* first, std::size_t count) RTTR_NOEXCEPT
+{
+    pool_slot* last = first;
+    for (std::size_t i = 1; i < count; ++i)
+        last = last->m_next;
+
+    pool_slot* rest = last->m_next;
+    last->m_next = nullptr;
+    return rest;
+}
+
+} // end anonymous namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+pool_storage::pool_storage(std::size_t slot_size, std::size_t slot_align, std::size_t batch_size)
+:   m_slot_size(slot_size),
+    m_slot_align(slot_align),
+    m_batch_size(batch_size),
+    m_bin_hint(0),
+    m_overflow(nullptr),
+    m_has_overflow(false),
+    m_block_count(0),
+    m_capacity(0)
+{
+    for (auto& bin : m_bins)
+        bin.store(nullptr, std::memory_order_relaxed);
+
+    for (auto& block : m_blocks)
+        block.store(0, std::memory_order_relaxed);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+pool_storage::~pool_storage()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t pool_storage::get_capacity() const RTTR_NOEXCEPT
+{
+    return m_capacity.load(std::memory_order_relaxed);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t pool_storage::get_block_slot_count(std::size_t block_index) const RTTR_NOEXCEPT
+{
+    return (m_batch_size << (block_index < max_block_growth ? block_index : max_block_growth));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+pool_slot* pool_storage::pop_batch(std::size_t& count) RTTR_NOEXCEPT
+{
+    // a bin is always taken as a whole, so no other thread can modify the batch anymore
+    for (auto& bin : m_bins)
+    {
+        if (!bin.load(std::memory_order_relaxed))
+            continue;
+
+        if (pool_slot* batch = bin.exchange(nullptr, std::memory_order_acquire))
+        {
+            count = batch->m_count;
+            return batch;
+        }
+    }
+
+    if (!m_has_overflow.load(std::memory_order_acquire))
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(m_overflow_mutex);
+    pool_slot* batch = m_overflow;
+    if (!batch)
+        return nullptr;
+
+    m_overflow = batch->m_next_batch;
+    m_has_overflow.store(m_overflow != nullptr, std::memory_order_release);
+    count = batch->m_count;
+    return batch;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void pool_storage::push_batch(pool_slot* first, std::size_t count) RTTR_NOEXCEPT
+{
+    first->m_count = count;
+    first->m_next_batch = nullptr;
+
+    // start at different bins, so concurrent threads do not compete for the same one
+    const auto start = m_bin_hint.fetch_add(1, std::memory_order_relaxed);
+    for (std::size_t i = 0; i < bin_count; ++i)
+    {
+        auto& bin = m_bins[(start + i) % bin_count];
+        pool_slot* expected = nullptr;
+        if (bin.load(std::memory_order_relaxed) == nullptr &&
+            bin.compare_exchange_strong(expected, first, std::memory_order_release, std::memory_order_relaxed))
+        {
+            return;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_overflow_mutex);
+    first->m_next_batch = m_overflow;
+    m_overflow = first;
+    m_has_overflow.store(true, std::memory_order_release);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void pool_storage::push_magazine(pool_magazine& magazine) RTTR_NOEXCEPT
+{
+    while (magazine.m_head)
+    {
+        const auto count = std::min(magazine.m_count, m_batch_size);
+        pool_slot* batch = magazine.m_head;
+        magazine.m_head = split_chain(batch, count);
+        magazine.m_count -= count;
+        push_batch(batch, count);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+pool_slot* pool_storage::allocate_batch(std::size_t& count)
+{
+    std::lock_guard<std::mutex> lock(m_block_mutex);
+
+    // another thread might have allocated a block in the meantime
+    if (pool_slot* batch = pop_batch(count))
+        return batch;
+
+    const auto block_index = m_block_count.load(std::memory_order_relaxed);
+    if (block_index == max_block_count)
+        return nullptr;
+
+    const auto slot_count = get_block_slot_count(block_index);
+    std::unique_ptr<unsigned char[]> block(new unsigned char[m_slot_size * slot_count + m_slot_align - 1]);
+
+    auto address = reinterpret_cast<std::uintptr_t>(block.get());
+    address = (address + m_slot_align - 1) / m_slot_align * m_slot_align;
+    unsigned char* storage = reinterpret_cast<unsigned char*>(address);
+
+    // the block has to be known, before any of its slots can be handed out
+    m_block_memory[block_index] = std::move(block);
+    m_blocks[block_index].store(address, std::memory_order_relaxed);
+    m_block_count.store(block_index + 1, std::memory_order_release);
+    m_capacity.fetch_add(slot_count, std::memory_order_relaxed);
+
+    pool_slot* result = nullptr;
+    for (std::size_t first = 0; first < slot_count; first += m_batch_size)
+    {
+        const auto batch_count = std::min(m_batch_size, slot_count - first);
+        pool_slot* head = nullptr;
+        for (std::size_t i = first + batch_count; i > first; --i)
+            head = ::new (storage + (i - 1) * m_slot_size) pool_slot{head, nullptr, 0};
+
+        if (!result)
+        {
+            result = head;
+            count = batch_count;
+        }
+        else
+        {
+            push_batch(head, batch_count);
+        }
+    }
+
+    return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool pool_storage::owns(const void* memory) const RTTR_NOEXCEPT
+{
+    const auto address = reinterpret_cast<std::uintptr_t>(memory);
+    const auto block_count = m_block_count.load(std::memory_order_acquire);
+    for (std::size_t index = 0; index < block_count; ++index)
+    {
+        const auto begin = m_blocks[index].load(std::memory_order_relaxed);
+        const auto end = begin + get_block_slot_count(index) * m_slot_size;
+        if (address >= begin && address < end)
+            return ((address - begin) % m_slot_size == 0);
+    }
+
+    return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+object_pool_private::object_pool_private(const type& t, std::size_t objects_per_block)
+:   m_type(t),
+    m_ptr_type(t.get_destructor().get_destructed_type()),
+    m_ctor(create_invalid_item<constructor>()),
+    m_dtor(t.get_destructor()),
+    m_is_valid(false),
+    m_id(create_pool_id())
+{
+    // only a constructor which needs no arguments and constructs the object itself can be used,
+    // e.g. a factory function creates its object somewhere else
+    for (const auto& ctor : t.get_constructors())
+    {
+        if (!ctor.can_invoke_at())
+            continue;
+
+        const auto params = ctor.get_parameter_infos();
+        if (std::all_of(params.begin(), params.end(), [](const parameter_info& param) { return param.has_default_value(); }))
+        {
+            m_ctor = ctor;
+            break;
+        }
+    }
+
+    m_is_valid = (t.get_sizeof() > 0 && m_ctor.is_valid() && m_dtor.is_valid());
+
+    // every slot has to fulfill the alignment of the object, when the slots are stored consecutively
+    const auto slot_align = std::max(t.get_alignof(), alignof(pool_slot));
+    const auto size = std::max(t.get_sizeof(), sizeof(pool_slot));
+    const auto slot_size = (size + slot_align - 1) / slot_align * slot_align;
+    m_storage = std::make_shared<pool_storage>(slot_size, slot_align, std::max(objects_per_block, std::size_t(1)));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+object_pool_private::~object_pool_private()
+{
+    // the magazines of this pool in the thread local caches are not touched here,
+    // they expire together with the storage and are removed lazily
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool object_pool_private::is_valid() const RTTR_NOEXCEPT
+{
+    return m_is_valid;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type object_pool_private::get_type() const RTTR_NOEXCEPT
+{
+    return m_type;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t object_pool_private::get_capacity() const RTTR_NOEXCEPT
+{
+    return m_storage->get_capacity();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant object_pool_private::create()
+{
+    if (!m_is_valid)
+        return variant();
+
+    void* memory = pop_slot();
+    if (!memory)
+        return variant();
+
+    variant obj = m_ctor.invoke_at(memory, nullptr, 0);
+    if (!obj.is_valid())
+        push_slot(memory);
+
+    return obj;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool object_pool_private::destroy(variant& obj) RTTR_NOEXCEPT
+{
+    if (!m_is_valid || obj.get_type() != m_ptr_type)
+        return false;
+
+    // for a pointer, the raw pointer is the address of the object itself
+    void* memory = obj.get_raw_ptr();
+    if (!memory || !m_storage->owns(memory) || !m_dtor.invoke_at(obj))
+        return false;
+
+    push_slot(memory);
+    return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+pool_magazine& object_pool_private::get_local_magazine()
+{
+    auto& cache = get_magazine_cache();
+    if (cache.m_last_id == m_id)
+        return *cache.m_last_magazine;
+
+    auto itr = cache.m_magazines.find(m_id);
+    if (itr == cache.m_magazines.end())
+    {
+        // remove the magazines of pools, which does not exist anymore
+        for (auto entry = cache.m_magazines.begin(); entry != cache.m_magazines.end();)
+        {
+            if (entry->second.m_storage.expired())
+                entry = cache.m_magazines.erase(entry);
+            else
+                ++entry;
+        }
+
+        itr = cache.m_magazines.emplace(m_id, pool_magazine_entry{m_storage, pool_magazine()}).first;
+    }
+
+    // the elements of an unordered_map are never moved, so it is safe to keep the pointer
+    cache.m_last_id = m_id;
+    cache.m_last_magazine = &itr->second.m_magazine;
+    return itr->second.m_magazine;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void* object_pool_private::pop_slot()
+{
+    auto& magazine = get_local_magazine();
+    if (!magazine.m_head)
+    {
+        std::size_t count = 0;
+        pool_slot* batch = m_storage->pop_batch(count);
+        if (!batch)
+            batch = m_storage->allocate_batch(count);
+
+        if (!batch)
+            return nullptr;
+
+        magazine.m_head = batch;
+        magazine.m_count = count;
+    }
+
+    pool_slot* slot = magazine.m_head;
+    magazine.m_head = slot->m_next;
+    --magazine.m_count;
+
+    slot->~pool_slot();
+    return slot;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+void object_pool_private::push_slot(void* memory) RTTR_NOEXCEPT
+{
+    auto& magazine = get_local_magazine();
+    magazine.m_head = ::new (memory) pool_slot{magazine.m_head, nullptr, 0};
+    ++magazine.m_count;
+
+    // a thread which only destroys objects must not collect all slots of the pool,
+    // so the magazine is bounded and gives back one batch to the other threads, when it is full
+    const auto batch_size = m_storage->get_batch_size();
+    if (magazine.m_count < 2 * batch_size)
+        return;
+
+    pool_slot* batch = magazine.m_head;
+    magazine.m_head = split_chain(batch, batch_size);
+    magazine.m_count -= batch_size;
+    m_storage->push_batch(batch, batch_size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace detail
+
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+object_pool::object_pool(const type& t, std::size_t objects_per_block)
+:   m_pimpl(detail::make_unique<detail::object_pool_private>(t, objects_per_block))
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+object_pool::~object_pool()
+{
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool object_pool::is_valid() const RTTR_NOEXCEPT
+{
+    return m_pimpl->is_valid();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+object_pool::operator bool() const RTTR_NOEXCEPT
+{
+    return m_pimpl->is_valid();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+type object_pool::get_type() const RTTR_NOEXCEPT
+{
+    return m_pimpl->get_type();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t object_pool::get_capacity() const RTTR_NOEXCEPT
+{
+    return m_pimpl->get_capacity();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant object_pool::create()
+{
+    return m_pimpl->create();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool object_pool::destroy(variant& obj) RTTR_NOEXCEPT
+{
+    return m_pimpl->destroy(obj);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+} // end namespace rttr
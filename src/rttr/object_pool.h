@@ -0,0 +1,157 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_OBJECT_POOL_H_
+#define RTTR_OBJECT_POOL_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include "rttr/type.h"
+#include "rttr/variant.h"
+
+#include <memory>
+
+namespace rttr
+{
+namespace detail
+{
+class object_pool_private;
+} // end namespace detail
+
+/*!
+ * The \ref object_pool class recycles the storage of reflected objects of one \ref type.
+ *
+ * The default constructor and the destructor of the type are resolved only once, when the pool is created.
+ * Every call to \ref create() constructs a new object in-place (see \ref type::create_in()) inside a slot of the pool,
+ * and \ref destroy() runs the destructor and gives the slot back to the pool; no heap allocation
+ * and no registry lookup is involved, as long as free slots are available.
+ *
+ * The pool can be used concurrently from multiple threads; an object may be destroyed by another thread than the one which created it.
+ * Every thread keeps a small local cache of at most 2 * \p objects_per_block free slots;
+ * only when this cache is empty or full, slots are exchanged in batches of \p objects_per_block slots
+ * with a lock-free free list shared by all threads. When a thread terminates, its cached slots are given back to the pool.
+ * New memory is allocated in blocks, which start with \p objects_per_block objects and grow geometrically.
+ *
+ * Copying and Assignment
+ * ----------------------
+ * An \ref object_pool object cannot be copied or assigned.
+ *
+ * Typical Usage
+ * ----------------------
+ *
+ * \code{.cpp}
+ *   object_pool pool(type::get_by_name("Foo"));
+ *   if (pool.is_valid())
+ *   {
+ *      variant obj = pool.create();    // contains a 'Foo*'
+ *      pool.get_type().set_property_value("value", obj, 12);
+ *      pool.destroy(obj);              // 'obj' is invalid afterwards
+ *   }
+ * \endcode
+ *
+ * \remark Every object created by a pool has to be destroyed with the same pool, before the pool itself is destroyed.
+ *         The pool is independent of \ref type::create() and \ref type::destroy(); objects created with one of them
+ *         cannot be destroyed with the other.
+ */
+class RTTR_API object_pool
+{
+public:
+    /*!
+     * \brief Creates a pool for objects of type \p t, which allocates its storage
+     *        in blocks of \p objects_per_block objects.
+     *
+     * When \p t has no constructor which can be invoked without arguments and can construct the object
+     * in-place (see \ref constructor::can_invoke_at()), the pool is not \ref is_valid() "valid".
+     * A value of zero for \p objects_per_block is treated as one.
+     */
+    explicit object_pool(const type& t, std::size_t objects_per_block = 64);
+
+    /*!
+     * \brief Destroys the pool and releases all its memory.
+     *
+     * \remark All objects created with this pool have to be \ref destroy() "destroyed" before.
+     */
+    ~object_pool();
+
+    object_pool(const object_pool&) = delete;
+    object_pool& operator=(const object_pool&) = delete;
+
+    /*!
+     * \brief Returns true, when objects can be created with this pool; otherwise false.
+     *
+     * \return True if this pool is valid, otherwise false.
+     */
+    bool is_valid() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Convenience function to check if this pool is valid or not.
+     *
+     * \return True if this pool is valid, otherwise false.
+     */
+    explicit operator bool() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns the type of the objects created by this pool.
+     *
+     * \return The type of the pooled objects.
+     */
+    type get_type() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Returns the number of objects, for which storage was allocated so far.
+     *
+     * \return The number of allocated slots.
+     */
+    std::size_t get_capacity() const RTTR_NOEXCEPT;
+
+    /*!
+     * \brief Creates a new object with the default constructor of \ref get_type().
+     *
+     * \return A variant which contains a pointer to the new object,
+     *         or an invalid \ref variant when the pool is not valid.
+     */
+    variant create();
+
+    /*!
+     * \brief Destroys the object contained in \p obj and gives its storage back to the pool.
+     *
+     * \remark The object has to be created with \ref create() of this pool;
+     *         pointers to objects which do not belong to the storage of this pool are rejected.
+     *         When the \p obj could be destroyed the given \p obj is invalid after calling this method;
+     *         Otherwise it is still valid.
+     *
+     * \return True if the object could be destroyed, otherwise false.
+     */
+    bool destroy(variant& obj) RTTR_NOEXCEPT;
+
+private:
+    std::unique_ptr<detail::object_pool_private> m_pimpl;
+};
+
+} // end namespace rttr
+
+#endif // RTTR_OBJECT_POOL_H_
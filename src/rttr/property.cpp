@@ -32,6 +32,7 @@
 #include "rttr/argument.h"
 #include "rttr/instance.h"
 #include "rttr/enumeration.h"
+#include "rttr/variant_sequential_view.h"
 
 using namespace std;
 
@@ -128,6 +129,27 @@ type property::get_type() const RTTR_NOEXCEPT
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool property::has_offset() const RTTR_NOEXCEPT
+{
+    return m_wrapper->has_offset();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+std::size_t property::get_offset() const RTTR_NOEXCEPT
+{
+    return m_wrapper->get_offset();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool property::is_trivially_copyable() const RTTR_NOEXCEPT
+{
+    return m_wrapper->is_trivially_copyable();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 type property::get_declaring_type() const RTTR_NOEXCEPT
 {
     return m_wrapper->get_declaring_type();
@@ -149,6 +171,27 @@ variant property::get_value(instance object) const
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+bool property::get_values(array_range<instance> objects, variant_sequential_view output) const
+{
+    return m_wrapper->get_values(objects, output);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool property::set_values(array_range<instance> objects, const variant_sequential_view& input) const
+{
+    return m_wrapper->set_values(objects, input);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+detail::typed_property_thunk property::get_typed_thunk(string_view signature) const RTTR_NOEXCEPT
+{
+    return m_wrapper->get_typed_thunk(signature);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 variant property::get_metadata(const variant& key) const
 {
     return m_wrapper->get_metadata(key);
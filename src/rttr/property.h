@@ -32,7 +32,9 @@
 #include "rttr/detail/misc/class_item_mapper.h"
 #include "rttr/parameter_info.h"
 #include "rttr/access_levels.h"
+#include "rttr/array_range.h"
 #include "rttr/string_view.h"
+#include "rttr/typed_accessor.h"
 
 #include <string>
 
@@ -45,10 +47,12 @@ class instance;
 class argument;
 class property;
 class visitor;
+class variant_sequential_view;
 
 namespace detail
 {
     class property_wrapper_base;
+    struct typed_property_thunk;
 }
 
 /*!
@@ -73,6 +77,9 @@ namespace detail
  * When the property is declared as \ref is_static "static" you you still have to provide an empty instance object,
  * use therefore the default ctor of \ref instance::instance() "instance()", or as shortcut use simply `{}`.
  *
+ * When the class type and the value type of the property are known at compile time, use \ref get_accessor() to retrieve a \ref typed_accessor.
+ * It validates the types only once and reads and writes afterwards the value directly, without any \ref argument or \ref variant objects.
+ *
  * A property will be successfully \ref set_value "set" when the provided instance can be converted to the \ref get_declaring_type() "declared class" type.
  * The new forwarded property value must 100% match the type of the registered property. An automatically type conversion is **not** performed.
  *
@@ -207,6 +214,56 @@ class RTTR_API property
          */
         type get_declaring_type() const RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Returns true, when the value of this property is located at a fixed byte offset
+         *        inside an object of the \ref get_declaring_type() "declaring type"; otherwise false.
+         *
+         * That is the case for properties, which are registered with a member object pointer
+         * of the declaring type itself and without any \ref policy::prop "property policy".
+         * Properties which are registered with getter/setter functions, static properties
+         * or member object pointers of a base class will return false.
+         *
+         * \remark When the property is not valid, this function will return false.
+         *
+         * \see get_offset(), is_trivially_copyable()
+         *
+         * \return True, when the property has a fixed offset, otherwise false.
+         */
+        bool has_offset() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns the byte offset of the property value,
+         *        relative to the start address of an object of the \ref get_declaring_type() "declaring type".
+         *
+         * The value can be accessed directly via this offset, which is e.g. useful for gathering
+         * the values of many objects without the need to box every value into a \ref variant.
+         * For an object of a derived class, e.g. when the property was retrieved through a derived type,
+         * the offset is relative to the subobject of the declaring type and not to the derived object itself;
+         * convert the object first to the declaring type.
+         *
+         * \remark When the property does not \ref has_offset() "have an offset", this function will return 0.
+         *
+         * \see has_offset(), is_trivially_copyable()
+         *
+         * \return The byte offset of the property value.
+         */
+        std::size_t get_offset() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns true, when the property \ref has_offset() "has an offset" and the property \ref get_type() "type"
+         *        is trivially copyable; otherwise false.
+         *
+         * Then the value can be copied as raw memory of \ref type::get_sizeof() "get_type().get_sizeof()" bytes,
+         * starting at the \ref get_offset() "offset" inside the object.
+         *
+         * \remark When the property is not valid, this function will return false.
+         *
+         * \see has_offset(), get_offset()
+         *
+         * \return True, when the property value can be copied with a raw memory copy, otherwise false.
+         */
+        bool is_trivially_copyable() const RTTR_NOEXCEPT;
+
         /*!
          * \brief Set the property of the given instance \p object to the given value \p arg.
          *
@@ -231,6 +288,104 @@ class RTTR_API property
          */
         variant get_value(instance object) const;
 
+        /*!
+         * \brief Reads the property value of every instance in \p objects and stores it
+         *        in the sequential container \p output, in the same order.
+         *
+         * The value type of the container has to be the \ref get_type() "type" of the property;
+         * a dynamic container will be resized to the number of objects.
+         * The type is validated only once, afterwards the values are read directly from the registered accessor,
+         * without creating a \ref variant for every value. For properties registered with a member object pointer
+         * or getter/setter functions and a `std::vector` as container, the values are also assigned directly
+         * to the items of the vector; other containers are written item by item through the view.
+         *
+         * \code{.cpp}
+         *  std::vector<instance> objects = { obj_1, obj_2, obj_3 };
+         *  std::vector<int> values;
+         *  variant var = std::ref(values);
+         *  prop.get_values({objects.data(), objects.size()}, var.create_sequential_view());
+         * \endcode
+         *
+         * \remark When the value type does not match, a fixed size container has a different size,
+         *         or one of the objects cannot be converted to the class type of the property, this function will return false.
+         *         All objects are validated before anything is written, so then the container is not modified.
+         *
+         * \see set_values(), get_value()
+         *
+         * \return The return value indicates whether the operation was successful or not.
+         */
+        bool get_values(array_range<instance> objects, variant_sequential_view output) const;
+
+        /*!
+         * \brief Sets the property value of every instance in \p objects to the value at the same index
+         *        of the sequential container \p input.
+         *
+         * The value type of the container has to be the \ref get_type() "type" of the property
+         * and the container has to have the same size as \p objects.
+         * For properties registered with a member object pointer or getter/setter functions and a `std::vector` as container,
+         * the items are read directly from the vector; for other containers a \ref variant is created for every item.
+         *
+         * \remark When the property is \ref is_readonly "read only", the value type or size does not match, or one of the objects
+         *         cannot be converted to the class type of the property, this function will return false.
+         *         All objects are validated before the first value is set, so then no object is modified.
+         *
+         * \see get_values(), set_value()
+         *
+         * \return The return value indicates whether the operation was successful or not.
+         */
+        bool set_values(array_range<instance> objects, const variant_sequential_view& input) const;
+
+        /*!
+         * \brief Reads the property value of \p count objects of type \p C, which are located in memory
+         *        beginning at \p objects, every \p stride bytes; e.g. `sizeof(C)` for a plain array of objects.
+         *        The values are written to the array \p output, which has to provide space for \p count values.
+         *
+         * The requirements for the types \p C and \p T are the same like for \ref get_accessor(), but \p T cannot be a reference.
+         * The types are validated only once, afterwards all values are read in a single typed loop.
+         *
+         * \remark When the types does not match, the property is static or not valid, nothing is read and false is returned.
+         *
+         * \see set_values(), get_accessor()
+         *
+         * \return The return value indicates whether the operation was successful or not.
+         */
+        template<typename C, typename T>
+        bool get_values(const C* objects, std::size_t stride, std::size_t count, T* output) const;
+
+        /*!
+         * \brief Sets the property value of \p count objects of type \p C, which are located in memory
+         *        beginning at \p objects, every \p stride bytes, to the values of the array \p input.
+         *
+         * The requirements for the types \p C and \p T are the same like for \ref get_accessor(), but \p T cannot be a reference.
+         *
+         * \remark When the types does not match, the property is \ref is_readonly "read only",
+         *         static or not valid, nothing is written and false is returned.
+         *
+         * \see get_values(), get_accessor()
+         *
+         * \return The return value indicates whether the operation was successful or not.
+         */
+        template<typename C, typename T>
+        bool set_values(C* objects, std::size_t stride, std::size_t count, const T* input) const;
+
+        /*!
+         * \brief Returns a \ref typed_accessor, which reads and writes the value of this property directly.
+         *
+         * The class type \p C has to be the class of the registered member object pointer (or getter function)
+         * or the declaring type of this property. The value type \p T has to match **exactly**
+         * the type of the member object or the return type of the getter function, without any reference or cv-qualifier.
+         * To read the value without a copy, \p T can be a const reference to this type;
+         * this is supported for member objects and for getter functions returning a reference.
+         *
+         * \remark When the types does not match, the property is static or not valid, an invalid accessor will be returned.
+         *
+         * \see typed_accessor
+         *
+         * \return A typed accessor for the given class and value type.
+         */
+        template<typename C, typename T>
+        typed_accessor<C, T> get_accessor() const RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns the meta data for the given key \p key.
          *
@@ -261,6 +416,8 @@ class RTTR_API property
 
         void visit(visitor& visitor) const RTTR_NOEXCEPT;
 
+        detail::typed_property_thunk get_typed_thunk(string_view signature) const RTTR_NOEXCEPT;
+
         template<typename T>
         friend T detail::create_item(const detail::class_item_to_wrapper_t<T>* wrapper);
         template<typename T>
@@ -273,4 +430,6 @@ class RTTR_API property
 
 } // end namespace rttr
 
+#include "rttr/detail/impl/property_impl.h"
+
 #endif // RTTR_PROPERTY_H_
@@ -26,7 +26,10 @@
 ####################################################################################
 
 set(HEADER_FILES access_levels.h
+                 access_plan.h
                  argument.h
+                 binary_serialization.h
+                 binary_view.h
                  array_range.h
                  associative_mapper.h
                  constructor.h
@@ -35,8 +38,11 @@ set(HEADER_FILES access_levels.h
                  enum_flags.h
                  filter_item.h
                  instance.h
+                 json_serialization.h
                  library.h
+                 mapped_file.h
                  method.h
+                 object_pool.h
                  policy.h
                  property.h
                  parameter_info.h
@@ -51,11 +57,14 @@ set(HEADER_FILES access_levels.h
                  type
                  type.h
                  type_list.h
+                 typed_accessor.h
+                 typed_invoker.h
                  variant.h
                  variant_associative_view.h
                  variant_sequential_view.h
                  visitor.h
                  wrapper_mapper.h
+                 detail/access_plan/access_plan_p.h
                  detail/base/core_prerequisites.h
                  detail/base/version.h.in
                  detail/base/version.rc.in
@@ -88,15 +97,22 @@ set(HEADER_FILES access_levels.h
                  detail/impl/associative_mapper_impl.h
                  detail/impl/enum_flags_impl.h
                  detail/impl/instance_impl.h
+                 detail/impl/method_impl.h
+                 detail/impl/property_impl.h
                  detail/impl/rttr_cast_impl.h
                  detail/impl/sequential_mapper_impl.h
                  detail/impl/string_view_impl.h
+                 detail/impl/typed_accessor_impl.h
+                 detail/impl/typed_invoker_impl.h
                  detail/impl/wrapper_mapper_impl.h
                  detail/library/library_p.h
+                 detail/mapped_file/mapped_file_p.h
+                 detail/object_pool/object_pool_p.h
                  detail/metadata/metadata.h
                  detail/metadata/metadata_handler.h
                  detail/method/method_accessor.h
                  detail/method/method_invoker.h
+                 detail/method/method_thunk.h
                  detail/method/method_wrapper.h
                  detail/method/method_wrapper_base.h
                  detail/misc/argument_wrapper.h
@@ -123,12 +139,15 @@ set(HEADER_FILES access_levels.h
                  detail/policies/meth_policies.h
                  detail/policies/ctor_policies.h
                  detail/property/property_accessor.h
+                 detail/property/property_batch_access.h
+                 detail/property/property_thunk.h
                  detail/property/property_wrapper.h
                  detail/property/property_wrapper_base.h
                  detail/property/property_wrapper_func.h
                  detail/property/property_wrapper_member_func.h
                  detail/property/property_wrapper_member_object.h
                  detail/property/property_wrapper_object.h
+                 detail/property/typed_property_thunk.h
                  detail/registration/bind_types.h
                  detail/registration/bind_impl.h
                  detail/registration/register_base_class_from_accessor.h
@@ -136,6 +155,11 @@ set(HEADER_FILES access_levels.h
                  detail/registration/registration_executer.h
                  detail/registration/registration_manager.h
                  detail/registration/registration_state_saver.h
+                 detail/serialization/binary_format.h
+                 detail/serialization/binary_reader_p.h
+                 detail/serialization/binary_writer_p.h
+                 detail/serialization/json_reader_p.h
+                 detail/serialization/serialization_utility.h
                  detail/type/accessor_type.h
                  detail/type/base_classes.h
                  detail/type/get_create_variant_func.h
@@ -170,11 +194,17 @@ set(HEADER_FILES access_levels.h
                  detail/visitor/visitor_registration.h
                 )
 
-set(SOURCE_FILES constructor.cpp
+set(SOURCE_FILES access_plan.cpp
+                 binary_serialization.cpp
+                 binary_view.cpp
+                 constructor.cpp
                  destructor.cpp
                  enumeration.cpp
+                 json_serialization.cpp
                  library.cpp
+                 mapped_file.cpp
                  method.cpp
+                 object_pool.cpp
                  parameter_info.cpp
                  policy.cpp
                  property.cpp
@@ -194,8 +224,11 @@ set(SOURCE_FILES constructor.cpp
                  detail/enumeration/enumeration_wrapper_base.cpp
                  detail/library/library_win.cpp
                  detail/library/library_unix.cpp
+                 detail/mapped_file/mapped_file_win.cpp
+                 detail/mapped_file/mapped_file_unix.cpp
                  detail/method/method_wrapper_base.cpp
                  detail/parameter_info/parameter_info_wrapper_base.cpp
+                 detail/property/property_batch_access.cpp
                  detail/property/property_wrapper_base.cpp
                  detail/registration/registration_executer.cpp
                  detail/registration/registration_state_saver.cpp
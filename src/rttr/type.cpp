@@ -197,8 +197,8 @@ variant type::create(vector<argument> args) const
     auto& ctors = m_type_data->m_class_data.m_ctors;
     for (const auto& ctor : ctors)
     {
-        if (detail::compare_with_arg_list::compare(ctor.get_parameter_infos(), args))
-            return ctor.invoke_variadic(std::move(args));
+        if (detail::compare_with_arg_list::compare(ctor.get_parameter_infos(), args.data(), args.size()))
+            return ctor.invoke_variadic(args.data(), args.size());
     }
 
     return variant();
@@ -213,6 +213,37 @@ bool type::destroy(variant& obj) const RTTR_NOEXCEPT
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+variant type::create_in(void* memory, vector<argument> args) const
+{
+    return create_in(memory, args.data(), args.size());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant type::create_in(void* memory, const argument* args, std::size_t arg_count) const
+{
+    auto& ctors = m_type_data->m_class_data.m_ctors;
+    for (const auto& ctor : ctors)
+    {
+        if (ctor.can_invoke_at() &&
+            detail::compare_with_arg_list::compare(ctor.get_parameter_infos(), args, arg_count))
+        {
+            return ctor.invoke_at(memory, args, arg_count);
+        }
+    }
+
+    return variant();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+bool type::destroy_in(variant& obj) const RTTR_NOEXCEPT
+{
+    return get_destructor().invoke_at(obj);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 property type::get_property(string_view name) const RTTR_NOEXCEPT
 {
     const auto raw_t = get_raw_type();
@@ -434,6 +465,13 @@ enumeration type::get_enumeration() const RTTR_NOEXCEPT
 /////////////////////////////////////////////////////////////////////////////////////////
 
 variant type::invoke(string_view name, instance obj, std::vector<argument> args) const
+{
+    return invoke(name, obj, args.data(), args.size());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant type::invoke(string_view name, instance obj, const argument* args, std::size_t arg_count) const
 {
     const auto raw_t = get_raw_type();
     const auto& methvec = raw_t.m_type_data->m_class_data.m_methods;
@@ -441,9 +479,9 @@ variant type::invoke(string_view name, instance obj, std::vector<argument> args)
     {
         const auto& meth = *mit ;
         if ( meth.get_name() == name &&
-             detail::compare_with_arg_list::compare(meth.get_parameter_infos(), args))
+             detail::compare_with_arg_list::compare(meth.get_parameter_infos(), args, arg_count))
         {
-            return meth.invoke_variadic(obj, args);
+            return meth.invoke_variadic(obj, args, arg_count);
         }
     }
 
@@ -453,6 +491,13 @@ variant type::invoke(string_view name, instance obj, std::vector<argument> args)
 /////////////////////////////////////////////////////////////////////////////////////////
 
 variant type::invoke(string_view name, std::vector<argument> args)
+{
+    return invoke(name, args.data(), args.size());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+variant type::invoke(string_view name, const argument* args, std::size_t arg_count)
 {
     auto& meth_list = detail::type_register_private::get_instance().get_global_method_storage();
     auto itr = meth_list.find(name);
@@ -462,9 +507,9 @@ variant type::invoke(string_view name, std::vector<argument> args)
         if (meth.get_name() != name)
             break;
 
-        if (detail::compare_with_arg_list::compare(meth.get_parameter_infos(), args))
+        if (detail::compare_with_arg_list::compare(meth.get_parameter_infos(), args, arg_count))
         {
-            return meth.invoke_variadic(instance(), args);
+            return meth.invoke_variadic(instance(), args, arg_count);
         }
 
         ++itr;
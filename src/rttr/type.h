@@ -63,6 +63,7 @@ struct base_class_info;
 struct type_converter_base;
 class type_register;
 class type_register_private;
+class access_plan_private;
 
 static type get_invalid_type() RTTR_NOEXCEPT;
 struct invalid_type{};
@@ -350,6 +351,15 @@ class RTTR_API type
          */
         RTTR_INLINE std::size_t get_sizeof() const RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Returns the alignment requirement in bytes of the current type (i.e. `alignof(T)`).
+         *
+         * \remark For `void`, function types or an invalid type, this function will return 0.
+         *
+         * \return The alignment of the type in bytes.
+         */
+        RTTR_INLINE std::size_t get_alignof() const RTTR_NOEXCEPT;
+
         /*!
          * \brief Returns true whether the given type is class; that is not an atomic type or a method.
          *
@@ -681,6 +691,34 @@ class RTTR_API type
          */
         variant create(std::vector<argument> args = std::vector<argument>()) const;
 
+        /*!
+         * \brief Creates an instance of the current type inside the already allocated storage \p memory,
+         *        with the given arguments \p args for the constructor.
+         *
+         * The storage has to be at least \ref get_sizeof() bytes large and aligned to \ref get_alignof().
+         * Destroy the returned object with \ref destroy_in(), the storage itself stays owned by the caller.
+         *
+         * \remark When the argument types does not match the parameter list of the constructor then the he will not be invoked.
+         *         Constructors with registered \ref default_arguments will be honored.
+         *         Constructors registered via a factory function are not considered,
+         *         see \ref constructor::can_invoke_at().
+         *
+         * \see constructor::invoke_at()
+         *
+         * \return Returns a pointer to the created instance, or an invalid \ref variant when no object could be created.
+         */
+        variant create_in(void* memory, std::vector<argument> args = std::vector<argument>()) const;
+
+        /*!
+         * \brief Creates an instance of the current type inside the already allocated storage \p memory,
+         *        using the \p arg_count arguments stored in the array \p args.
+         *
+         * \see create_in(void*, std::vector<argument>) const
+         *
+         * \return Returns a pointer to the created instance, or an invalid \ref variant when no object could be created.
+         */
+        variant create_in(void* memory, const argument* args, std::size_t arg_count) const;
+
         /*!
          * \brief Returns the corresponding destructor for this type.
          *
@@ -701,6 +739,17 @@ class RTTR_API type
          */
         bool destroy(variant& obj) const RTTR_NOEXCEPT;
 
+        /*!
+         * \brief Runs the destructor of the object contained in the variant \p obj, without releasing its storage.
+         *        This is the counterpart of \ref create_in().
+         *
+         * \remark When the \p obj could be destroyed the given \p obj is invalid after calling this method;
+         *         Otherwise it is still valid.
+         *
+         * \return True if the destructor of the object could be invoked, otherwise false.
+         */
+        bool destroy_in(variant& obj) const RTTR_NOEXCEPT;
+
 
         /*!
          * \brief Returns a property with the name \p name.
@@ -962,6 +1011,20 @@ class RTTR_API type
          */
         variant invoke(string_view name, instance obj, std::vector<argument> args) const;
 
+        /*!
+         * \brief Invokes the method named \p name of the current instance \p object,
+         *        using the \p arg_count arguments stored in the array \p args.
+         *
+         * In contrast to the overload with a `std::vector`, the arguments are not copied,
+         * which avoids any heap allocation for the argument list.
+         *
+         * \remark Methods with registered \ref default_arguments will be honored.
+         *
+         * \return A variant object containing the possible return value,
+         *         otherwise when it is a void function an empty but valid variant object.
+         */
+        variant invoke(string_view name, instance obj, const argument* args, std::size_t arg_count) const;
+
         /*!
          * \brief Invokes a global method named \p name with the specified argument \p args.
          *
@@ -971,6 +1034,18 @@ class RTTR_API type
          */
         static variant invoke(string_view name, std::vector<argument> args);
 
+        /*!
+         * \brief Invokes a global method named \p name, using the \p arg_count arguments stored in the array \p args.
+         *
+         * In contrast to the overload with a `std::vector`, the arguments are not copied,
+         * which avoids any heap allocation for the argument list.
+         *
+         * \return A variant object containing the possible return value,
+         *         otherwise when it is a void function an empty but valid variant object.
+         *         Methods with registered \ref default_arguments will be honored.
+         */
+        static variant invoke(string_view name, const argument* args, std::size_t arg_count);
+
         /*!
          * \brief Register a converter func `F`, which will be used internally by the
          *        \ref variant class to convert between types.
@@ -1211,6 +1286,7 @@ class RTTR_API type
         friend class instance;
         friend class detail::type_register;
         friend class detail::type_register_private;
+        friend class detail::access_plan_private;
         friend class visitor;
         friend struct detail::class_data;
 
@@ -0,0 +1,174 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_TYPED_ACCESSOR_H_
+#define RTTR_TYPED_ACCESSOR_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+#include <type_traits>
+
+namespace rttr
+{
+
+class property;
+
+/*!
+ * The \ref typed_accessor class template provides direct read and write access to the value of a \ref property,
+ * when the class type \p C and the value type \p T are known at compile time.
+ *
+ * A instance of this class can only be obtained from \ref property::get_accessor().
+ * The declaring type and the value type are validated only once, when the accessor is retrieved.
+ * Afterwards \ref get() and \ref set() will neither create a \ref variant nor an \ref argument object,
+ * nor convert the instance; the underlying member object pointer or getter/setter function is used directly.
+ *
+ * The value type \p T is the type of the underlying member object or the return type of the getter function,
+ * without any reference or cv-qualifier; then \ref get() returns a copy of the value.
+ * To read the value without a copy, \p T can be also a const reference to this type.
+ * This is possible for member objects and for getter functions which return a reference;
+ * for getter functions which return by value, only a copy can be retrieved.
+ * Registered property policies are not taken into account.
+ * The class type \p C is either the class of the member object pointer (or getter function) or the declaring type of the property.
+ *
+ * Only properties which belongs to a class and are not static can be accessed with a \ref typed_accessor.
+ *
+ * Copying and Assignment
+ * ----------------------
+ * A \ref typed_accessor object is lightweight and can be copied by value. However, each copy will refer to the same underlying property.
+ *
+ * Typical Usage
+ * ----------------------
+ *
+ * \code{.cpp}
+ *  using namespace rttr;
+ *  struct MyStruct { int value = 23; };
+ *  //...
+ *  property prop = type::get<MyStruct>().get_property("value");
+ *  auto acc = prop.get_accessor<MyStruct, const int&>();
+ *  if (acc)
+ *  {
+ *     MyStruct obj;
+ *     const int& value = acc.get(obj);
+ *     std::cout << value;        // prints 23
+ *     acc.set(obj, 42);
+ *     std::cout << value;        // prints 42
+ *  }
+ * \endcode
+ *
+ * \see property
+ */
+template<typename C, typename T>
+class typed_accessor
+{
+    public:
+        //! The type of the property value, without any reference or cv-qualifier.
+        using value_type = typename std::remove_cv<typename std::remove_reference<T>::type>::type;
+
+        static_assert(std::is_same<T, value_type>::value || std::is_same<T, const value_type&>::value,
+                      "The value type has to be a type without cv-qualifier or a const reference to it.");
+
+        /*!
+         * \brief Default constructor. Constructs an invalid accessor.
+         */
+        typed_accessor() RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns true if this accessor is valid, otherwise false.
+         *
+         * \return True if this accessor is valid, otherwise false.
+         */
+        bool is_valid() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Convenience function to check if this accessor is valid or not.
+         *
+         * \return True if this accessor is valid, otherwise false.
+         */
+        explicit operator bool() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns true if the property cannot be set with this accessor, otherwise false.
+         *
+         * \return True if the property is \ref property::is_readonly "read only", otherwise false.
+         */
+        bool is_readonly() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns the current property value of the given \p object.
+         *
+         * When \p T is a const reference, the returned reference refers directly to the value inside \p object.
+         *
+         * \remark Calling this function on an invalid accessor results in undefined behaviour.
+         *
+         * \return The property value.
+         */
+        T get(const C& object) const;
+
+        /*!
+         * \brief Set the property of the given \p object to the given \p value.
+         *
+         * \remark Calling this function on an invalid accessor results in undefined behaviour.
+         *
+         * \return True if the value could be set; false when the property is \ref is_readonly "read only".
+         */
+        bool set(C& object, const value_type& value) const;
+
+        /*!
+         * \brief Returns true if this accessor refers to the same property like the \p other.
+         *
+         * \return True if both accessors are equal, otherwise false.
+         */
+        bool operator==(const typed_accessor& other) const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns true if this accessor refers not to the same property like the \p other.
+         *
+         * \return True if both accessors are different, otherwise false.
+         */
+        bool operator!=(const typed_accessor& other) const RTTR_NOEXCEPT;
+
+    private:
+        using getter_func = T(*)(const void*, const C&);
+        using setter_func = void(*)(const void*, C&, const value_type&);
+
+        typed_accessor(getter_func getter_thunk, setter_func setter_thunk,
+                       const void* getter, const void* setter) RTTR_NOEXCEPT;
+
+        friend class property;
+
+    private:
+        getter_func m_getter_thunk;
+        setter_func m_setter_thunk;
+        const void* m_getter;
+        const void* m_setter;
+};
+
+} // end namespace rttr
+
+#include "rttr/detail/impl/typed_accessor_impl.h"
+
+#endif // RTTR_TYPED_ACCESSOR_H_
@@ -0,0 +1,151 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#ifndef RTTR_TYPED_INVOKER_H_
+#define RTTR_TYPED_INVOKER_H_
+
+#include "rttr/detail/base/core_prerequisites.h"
+
+namespace rttr
+{
+
+class method;
+
+template<typename Signature>
+class typed_invoker;
+
+/*!
+ * The \ref typed_invoker class template provides a direct call into a \ref method with a signature known at compile time.
+ *
+ * A instance of this class can only be obtained from \ref method::get_invoker().
+ * The requested signature is validated only once, when the invoker is retrieved.
+ * A call through a valid invoker does not pack any arguments into \ref argument objects,
+ * does not convert the instance and does not return a \ref variant; it has the cost of a call via a function pointer.
+ *
+ * The signature has to match **exactly** the signature of the registered function.
+ * For member functions the first argument is a reference to the object,
+ * either as reference of the class type of the member function pointer or of the declaring type of the method.
+ * Only `const` member functions can be invoked with a const reference.
+ * When the method was registered with the policy \ref policy::meth::discard_return, the return type is `void`;
+ * with \ref policy::meth::return_ref_as_ptr it is a pointer.
+ *
+ * Default arguments are not taken into account, all arguments have to be forwarded.
+ *
+ * Copying and Assignment
+ * ----------------------
+ * A \ref typed_invoker object is lightweight and can be copied by value. However, each copy will refer to the same underlying method.
+ *
+ * Typical Usage
+ * ----------------------
+ *
+ * \code{.cpp}
+ *  using namespace rttr;
+ *  struct MyStruct { int my_method(int param) { return param; } };
+ *  //...
+ *  method meth = type::get<MyStruct>().get_method("my_method");
+ *  auto func = meth.get_invoker<int(MyStruct&, int)>();
+ *  if (func)
+ *  {
+ *     MyStruct obj;
+ *     std::cout << func(obj, 23); // prints 23
+ *  }
+ * \endcode
+ *
+ * \see method
+ */
+template<typename R, typename... Args>
+class typed_invoker<R(Args...)>
+{
+    public:
+        /*!
+         * \brief Default constructor. Constructs an invalid invoker.
+         */
+        typed_invoker() RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns true if this invoker is valid, otherwise false.
+         *
+         * \return True if this invoker is valid, otherwise false.
+         */
+        bool is_valid() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Convenience function to check if this invoker is valid or not.
+         *
+         * \return True if this invoker is valid, otherwise false.
+         */
+        explicit operator bool() const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Invokes the underlying function with the given arguments \p args.
+         *
+         * \remark Invoking an invalid invoker results in undefined behaviour.
+         *
+         * \return The return value of the underlying function.
+         */
+        R invoke(Args... args) const;
+
+        /*!
+         * \brief Invokes the underlying function with the given arguments \p args.
+         *
+         * \remark Invoking an invalid invoker results in undefined behaviour.
+         *
+         * \return The return value of the underlying function.
+         */
+        R operator()(Args... args) const;
+
+        /*!
+         * \brief Returns true if this invoker calls the same function like the \p other.
+         *
+         * \return True if both invokers are equal, otherwise false.
+         */
+        bool operator==(const typed_invoker& other) const RTTR_NOEXCEPT;
+
+        /*!
+         * \brief Returns true if this invoker calls not the same function like the \p other.
+         *
+         * \return True if both invokers are different, otherwise false.
+         */
+        bool operator!=(const typed_invoker& other) const RTTR_NOEXCEPT;
+
+    private:
+        using thunk_func = R(*)(const void*, Args...);
+
+        typed_invoker(thunk_func thunk, const void* func) RTTR_NOEXCEPT;
+
+        friend class method;
+
+    private:
+        thunk_func  m_thunk;
+        const void* m_func;
+};
+
+} // end namespace rttr
+
+#include "rttr/detail/impl/typed_invoker_impl.h"
+
+#endif // RTTR_TYPED_INVOKER_H_
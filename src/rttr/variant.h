@@ -60,6 +60,7 @@ namespace detail
     struct data_address_container;
     template<typename T>
     struct empty_type_converter;
+    class object_pool_private;
 
     template<typename T, typename Tp, typename Converter = empty_type_converter<T>>
     struct variant_data_base_policy;
@@ -1046,6 +1047,7 @@ class RTTR_API variant
     private:
         friend class argument;
         friend class instance;
+        friend class detail::object_pool_private;
 
         template<typename T, typename Tp, typename Converter>
         friend struct detail::variant_data_base_policy;
@@ -43,6 +43,11 @@ namespace rttr
     class instance;
     class argument;
 
+namespace detail
+{
+    struct variant_sequential_view_access;
+} // end namespace detail
+
 /*!
  * The \ref variant_sequential_view describes a class that refers to an
  * <a target="_blank" href=https://en.wikipedia.org/wiki/Sequence_container_(C%2B%2B)>sequence container</a> (e.g: `std::vector`)
@@ -422,6 +427,7 @@ class RTTR_API variant_sequential_view
     private:
         friend class variant;
         friend class argument;
+        friend struct detail::variant_sequential_view_access;
 
         detail::variant_sequential_view_private m_view;
 };
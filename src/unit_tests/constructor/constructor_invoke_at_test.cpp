@@ -0,0 +1,189 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/registration>
+#include <catch/catch.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+struct ctor_invoke_at_test
+{
+    ctor_invoke_at_test() { ++ctor_count; }
+    ctor_invoke_at_test(int value_1, std::string text) : value(value_1), text(std::move(text)) { ++ctor_count; }
+    ~ctor_invoke_at_test() { ++dtor_count; }
+
+    static ctor_invoke_at_test create_object() { return ctor_invoke_at_test(); }
+
+    alignas(16) double data[2] = {0.0, 0.0};
+    int value = 0;
+    std::string text;
+
+    static int ctor_count;
+    static int dtor_count;
+};
+
+int ctor_invoke_at_test::ctor_count = 0;
+int ctor_invoke_at_test::dtor_count = 0;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<ctor_invoke_at_test>("ctor_invoke_at_test")
+        .constructor<>()
+        (
+            policy::ctor::as_object
+        )
+        .constructor<int, std::string>()
+        (
+            default_arguments(std::string("default text")),
+            policy::ctor::as_std_shared_ptr
+        )
+        .constructor(&ctor_invoke_at_test::create_object)
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("constructor - invoke_at", "[constructor]")
+{
+    type t = type::get<ctor_invoke_at_test>();
+    REQUIRE(t.get_sizeof() == sizeof(ctor_invoke_at_test));
+    REQUIRE(t.get_alignof() == alignof(ctor_invoke_at_test));
+
+    alignas(ctor_invoke_at_test) unsigned char buffer[sizeof(ctor_invoke_at_test)];
+    const int ctor_count = ctor_invoke_at_test::ctor_count;
+    const int dtor_count = ctor_invoke_at_test::dtor_count;
+
+    SECTION("default ctor")
+    {
+        constructor ctor = t.get_constructor();
+        variant var = ctor.invoke_at(buffer);
+        // the object is always returned as pointer, regardless of the registered policy
+        REQUIRE(var.is_type<ctor_invoke_at_test*>() == true);
+        CHECK(static_cast<void*>(var.get_value<ctor_invoke_at_test*>()) == static_cast<void*>(buffer));
+        CHECK(ctor_invoke_at_test::ctor_count == ctor_count + 1);
+
+        destructor dtor = t.get_destructor();
+        CHECK(dtor.invoke_at(var) == true);
+        CHECK(var.is_valid() == false);
+        CHECK(ctor_invoke_at_test::dtor_count == dtor_count + 1);
+    }
+
+    SECTION("with arguments")
+    {
+        constructor ctor = t.get_constructor({type::get<int>(), type::get<std::string>()});
+        variant var = ctor.invoke_at(buffer, {23, std::string("some text")});
+        REQUIRE(var.is_type<ctor_invoke_at_test*>() == true);
+
+        auto obj = var.get_value<ctor_invoke_at_test*>();
+        CHECK(obj->value == 23);
+        CHECK(obj->text == "some text");
+        CHECK(t.destroy_in(var) == true);
+    }
+
+    SECTION("with default arguments")
+    {
+        constructor ctor = t.get_constructor({type::get<int>(), type::get<std::string>()});
+        argument args[] = {42};
+        variant var = ctor.invoke_at(buffer, args, 1);
+        REQUIRE(var.is_type<ctor_invoke_at_test*>() == true);
+
+        auto obj = var.get_value<ctor_invoke_at_test*>();
+        CHECK(obj->value == 42);
+        CHECK(obj->text == "default text");
+        CHECK(t.destroy_in(var) == true);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("constructor - invoke_at negative", "[constructor]")
+{
+    type t = type::get<ctor_invoke_at_test>();
+    alignas(ctor_invoke_at_test) unsigned char buffer[sizeof(ctor_invoke_at_test)];
+    const int ctor_count = ctor_invoke_at_test::ctor_count;
+
+    constructor ctor = t.get_constructor({type::get<int>(), type::get<std::string>()});
+    CHECK(ctor.invoke_at(nullptr, {23}).is_valid() == false);
+    CHECK(ctor.invoke_at(buffer).is_valid() == false);
+    CHECK(ctor.invoke_at(buffer, {23, std::string("text"), 1}).is_valid() == false);
+    CHECK(ctor.invoke_at(buffer, {std::string("text")}).is_valid() == false);
+
+    // a factory function cannot construct an object in-place
+    auto ctor_list = t.get_constructors();
+    REQUIRE(ctor_list.size() == 3);
+    std::vector<constructor> ctors(ctor_list.cbegin(), ctor_list.cend());
+    CHECK(ctors[0].can_invoke_at() == true);
+    CHECK(ctors[1].can_invoke_at() == true);
+    CHECK(ctors[2].can_invoke_at() == false);
+    CHECK(ctors[2].invoke_at(buffer).is_valid() == false);
+
+    // the storage has to be aligned for the type
+    alignas(ctor_invoke_at_test) unsigned char big_buffer[sizeof(ctor_invoke_at_test) + alignof(ctor_invoke_at_test)];
+    void* misaligned_memory = big_buffer + alignof(ctor_invoke_at_test) / 2;
+    CHECK(ctors[0].invoke_at(misaligned_memory).is_valid() == false);
+    CHECK(t.create_in(misaligned_memory).is_valid() == false);
+
+    CHECK(ctor_invoke_at_test::ctor_count == ctor_count);
+
+    constructor invalid_ctor = type::get_by_name("").get_constructor();
+    CHECK(invalid_ctor.can_invoke_at() == false);
+    CHECK(invalid_ctor.invoke_at(buffer).is_valid() == false);
+
+    // destroying a non pointer object in-place is not possible
+    variant var = 23;
+    CHECK(t.get_destructor().invoke_at(var) == false);
+    CHECK(var.is_valid() == true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("type - create_in", "[constructor]")
+{
+    type t = type::get<ctor_invoke_at_test>();
+    alignas(ctor_invoke_at_test) unsigned char buffer[sizeof(ctor_invoke_at_test)];
+
+    variant var = t.create_in(buffer, {5, std::string("text")});
+    REQUIRE(var.is_type<ctor_invoke_at_test*>() == true);
+    CHECK(var.get_value<ctor_invoke_at_test*>()->value == 5);
+    CHECK(t.destroy_in(var) == true);
+
+    // the storage can be reused afterwards
+    var = t.create_in(buffer);
+    REQUIRE(var.is_type<ctor_invoke_at_test*>() == true);
+    CHECK(var.get_value<ctor_invoke_at_test*>()->value == 0);
+    CHECK(t.destroy_in(var) == true);
+
+    CHECK(t.create_in(buffer, {std::string("text")}).is_valid() == false);
+    CHECK(type::get<int>().create_in(buffer).is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
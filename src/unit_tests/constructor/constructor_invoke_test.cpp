@@ -310,6 +310,34 @@ TEST_CASE("constructor - invoke variadic", "[constructor]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("constructor - invoke variadic - argument array", "[constructor]")
+{
+    type t = type::get<ctor_invoke_test>();
+
+    constructor ctor = t.get_constructor({type::get<int>(), type::get<int>(), type::get<int>(),
+                                          type::get<int>(), type::get<int>(), type::get<int>(),
+                                          type::get<const int* const>()
+                                         });
+    REQUIRE(ctor.is_valid() == true);
+
+    int v1 = 1, v2 = 2, v3 = 3, v4 = 4, v5 = 5, v6 = 6;
+    const int value = 23;
+    const int* ptr = &value;
+    argument args[] = {v1, v2, v3, v4, v5, v6, ptr};
+
+    variant var = ctor.invoke_variadic(args, 6);
+    CHECK(var.is_valid() == false);
+
+    var = ctor.invoke_variadic(args, 7);
+    CHECK(var.is_valid() == true);
+    ctor_invoke_test* obj = var.get_value<ctor_invoke_test*>();
+    CHECK(obj->value_1 == 1);
+    CHECK(obj->value_2 == 2);
+    CHECK(t.get_destructor().invoke(var) == true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("constructor - invoke ctor valid", "[constructor]")
 {
     auto range = type::get<ctor_invoke_arg_test>().get_constructors();
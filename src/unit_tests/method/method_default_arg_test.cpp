@@ -168,6 +168,13 @@ TEST_CASE("method - default argument test - invoke via type - global method", "[
     CHECK(type::invoke("global_meth_with_defaults", {23}).is_valid() == true);
     CHECK(type::invoke("global_meth_with_defaults", {23, std::string("This is a default")}).is_valid() == true);
     CHECK(type::invoke("global_meth_with_defaults", {23, std::string("This is a default"), nullptr, 45}).is_valid() == false);
+
+    int value = 23;
+    std::string text = "This is a default";
+    argument args[] = {value, text};
+    CHECK(type::invoke("global_meth_with_defaults", args, 0).is_valid() == false);
+    CHECK(type::invoke("global_meth_with_defaults", args, 1).is_valid() == true);
+    CHECK(type::invoke("global_meth_with_defaults", args, 2).is_valid() == true);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,158 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/registration>
+#include <catch/catch.hpp>
+
+#include <cstdlib>
+#include <new>
+
+using namespace rttr;
+using namespace std;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+// the heap allocations of this executable are counted, but only inside of 'count_allocations()',
+// in order to verify that an invoke with an argument array does not allocate any memory
+
+static thread_local bool g_count_allocations = false;
+static thread_local std::size_t g_allocation_count = 0;
+
+// the replacement operators use 'malloc()' and 'free()' on purpose
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size)
+{
+    if (g_count_allocations)
+        ++g_allocation_count;
+
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) RTTR_NOEXCEPT
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) RTTR_NOEXCEPT
+{
+    std::free(ptr);
+}
+
+template<typename F>
+static std::size_t count_allocations(const F& func)
+{
+    g_allocation_count = 0;
+    g_count_allocations = true;
+    func();
+    g_count_allocations = false;
+    return g_allocation_count;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct method_invoke_allocation_test
+{
+    int add(int a, int b, int c) { return a + b + c; }
+    int add_8(int a, int b, int c, int d, int e, int f, int g, int h) { return a + b + c + d + e + f + g + h; }
+};
+
+static int method_invoke_allocation_global(int a, int b, int c) { return a * b * c; }
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<method_invoke_allocation_test>("method_invoke_allocation_test")
+        .method("add", &method_invoke_allocation_test::add)
+        .method("add_8", &method_invoke_allocation_test::add_8)
+        ;
+
+    registration::method("method_invoke_allocation_global", &method_invoke_allocation_global);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - invoke_variadic - argument array does not allocate", "[method]")
+{
+    method_invoke_allocation_test obj;
+    type t = type::get<method_invoke_allocation_test>();
+    method meth_3 = t.get_method("add");
+    method meth_8 = t.get_method("add_8");
+    REQUIRE(meth_3.is_valid() == true);
+    REQUIRE(meth_8.is_valid() == true);
+    int v1 = 1, v2 = 2, v3 = 3, v4 = 4, v5 = 5, v6 = 6, v7 = 7, v8 = 8;
+
+    variant ret;
+    CHECK(count_allocations([&]()
+    {
+        argument args[] = {v1, v2, v3};
+        ret = meth_3.invoke_variadic(obj, args, 3);
+    }) == 0);
+    CHECK(ret == 6);
+
+    CHECK(count_allocations([&]()
+    {
+        argument args[] = {v1, v2, v3, v4, v5, v6, v7, v8};
+        ret = meth_8.invoke_variadic(obj, args, 8);
+    }) == 0);
+    CHECK(ret == 36);
+
+    // the std::vector overload has to allocate its argument list
+    CHECK(count_allocations([&]() { ret = meth_3.invoke_variadic(obj, {v1, v2, v3}); }) > 0);
+    CHECK(ret == 6);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("type - invoke - argument array does not allocate", "[method]")
+{
+    method_invoke_allocation_test obj;
+    type t = type::get<method_invoke_allocation_test>();
+    int v1 = 2, v2 = 3, v3 = 4;
+
+    variant ret;
+    CHECK(count_allocations([&]()
+    {
+        argument args[] = {v1, v2, v3};
+        ret = t.invoke("add", obj, args, 3);
+    }) == 0);
+    CHECK(ret == 9);
+
+    CHECK(count_allocations([&]()
+    {
+        argument args[] = {v1, v2, v3};
+        ret = type::invoke("method_invoke_allocation_global", args, 3);
+    }) == 0);
+    CHECK(ret == 24);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
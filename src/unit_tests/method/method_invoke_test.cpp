@@ -103,6 +103,37 @@ TEST_CASE("method - invoke", "[method]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("method - invoke_variadic - argument array", "[method]")
+{
+    type t = type::get<method_invoke_test>();
+    method_invoke_test obj;
+
+    int v1 = 1, v2 = 2, v3 = 3, v4 = 4, v5 = 5, v6 = 6, v7 = 7;
+    argument args[] = {v1, v2, v3, v4, v5, v6, v7};
+
+    CHECK(t.get_method("func_7").invoke_variadic(obj, args, 7).is_valid() == true);
+    CHECK(obj.m_invoked[7] == true);
+
+    CHECK(t.get_method("func_3").invoke_variadic(obj, args, 3).is_valid() == true);
+    CHECK(obj.m_invoked[3] == true);
+
+    CHECK(t.get_method("func_0").invoke_variadic(obj, nullptr, 0).is_valid() == true);
+    CHECK(obj.m_invoked[0] == true);
+
+    variant ret = t.get_method("func_9").invoke_variadic(obj, args + 6, 1);
+    REQUIRE(ret.is_type<int>() == true);
+    CHECK(ret.get_value<int>() == 7);
+
+    CHECK(t.invoke("func_2", obj, args, 2).is_valid() == true);
+    CHECK(obj.m_invoked[2] == true);
+
+    // wrong argument count
+    CHECK(t.get_method("func_7").invoke_variadic(obj, args, 6).is_valid() == false);
+    CHECK(t.invoke("func_2", obj, args, 3).is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("method - invoke - NEGATIVE - invalid method", "[method]")
 {
     method meth = type::get_by_name("").get_method("");
@@ -0,0 +1,195 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/registration>
+#include <catch/catch.hpp>
+
+#include <string>
+
+using namespace rttr;
+using namespace std;
+
+struct typed_invoker_base
+{
+    int base_func(int value) const { return value * 2; }
+};
+
+struct typed_invoker_test : typed_invoker_base
+{
+    void set_value(int value) { m_value = value; }
+    int get_value() const { return m_value; }
+    std::string concat(const std::string& text, int value) { return text + std::to_string(value); }
+    int& get_ref() { return m_value; }
+    static int add(int a, int b) { return a + b; }
+
+    int m_value = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<typed_invoker_test>("typed_invoker_test")
+        .method("set_value", &typed_invoker_test::set_value)
+        .method("get_value", &typed_invoker_test::get_value)
+        .method("concat", &typed_invoker_test::concat)
+        .method("get_ref", &typed_invoker_test::get_ref)
+        (
+            policy::meth::return_ref_as_ptr
+        )
+        .method("get_ref_discard", &typed_invoker_test::get_ref)
+        (
+            policy::meth::discard_return
+        )
+        .method("base_func", &typed_invoker_base::base_func)
+        .method("add", &typed_invoker_test::add)
+        .method("lambda", [](int value) { return value + 1; })
+        .method("std_func", std::function<int(int)>([](int value) { return value - 1; }))
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - get_invoker - member function", "[method]")
+{
+    type t = type::get<typed_invoker_test>();
+    typed_invoker_test obj;
+
+    auto setter = t.get_method("set_value").get_invoker<void(typed_invoker_test&, int)>();
+    REQUIRE(setter.is_valid() == true);
+    setter(obj, 42);
+    CHECK(obj.m_value == 42);
+
+    auto getter = t.get_method("get_value").get_invoker<int(const typed_invoker_test&)>();
+    REQUIRE(static_cast<bool>(getter) == true);
+    CHECK(getter(obj) == 42);
+
+    auto non_const_getter = t.get_method("get_value").get_invoker<int(typed_invoker_test&)>();
+    REQUIRE(non_const_getter.is_valid() == true);
+    CHECK(non_const_getter.invoke(obj) == 42);
+
+    auto concat = t.get_method("concat").get_invoker<std::string(typed_invoker_test&, const std::string&, int)>();
+    REQUIRE(concat.is_valid() == true);
+    CHECK(concat(obj, "text", 23) == "text23");
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - get_invoker - base class function", "[method]")
+{
+    type t = type::get<typed_invoker_test>();
+    method meth = t.get_method("base_func");
+    typed_invoker_test obj;
+
+    auto func_derived = meth.get_invoker<int(const typed_invoker_test&, int)>();
+    REQUIRE(func_derived.is_valid() == true);
+    CHECK(func_derived(obj, 21) == 42);
+
+    auto func_base = meth.get_invoker<int(typed_invoker_base&, int)>();
+    REQUIRE(func_base.is_valid() == true);
+    CHECK(func_base(obj, 2) == 4);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - get_invoker - static function", "[method]")
+{
+    type t = type::get<typed_invoker_test>();
+
+    auto add = t.get_method("add").get_invoker<int(int, int)>();
+    REQUIRE(add.is_valid() == true);
+    CHECK(add(20, 22) == 42);
+
+    auto lambda = t.get_method("lambda").get_invoker<int(int)>();
+    REQUIRE(lambda.is_valid() == true);
+    CHECK(lambda(41) == 42);
+
+    auto std_func = t.get_method("std_func").get_invoker<int(int)>();
+    REQUIRE(std_func.is_valid() == true);
+    CHECK(std_func(43) == 42);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - get_invoker - policies", "[method]")
+{
+    type t = type::get<typed_invoker_test>();
+    typed_invoker_test obj;
+
+    auto get_ptr = t.get_method("get_ref").get_invoker<int*(typed_invoker_test&)>();
+    REQUIRE(get_ptr.is_valid() == true);
+    CHECK(get_ptr(obj) == &obj.m_value);
+
+    CHECK(t.get_method("get_ref").get_invoker<int&(typed_invoker_test&)>().is_valid() == false);
+
+    auto discard = t.get_method("get_ref_discard").get_invoker<void(typed_invoker_test&)>();
+    REQUIRE(discard.is_valid() == true);
+    discard(obj);
+
+    CHECK(t.get_method("get_ref_discard").get_invoker<int&(typed_invoker_test&)>().is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - get_invoker - NEGATIVE", "[method]")
+{
+    type t = type::get<typed_invoker_test>();
+
+    // wrong argument types
+    CHECK(t.get_method("set_value").get_invoker<void(typed_invoker_test&, double)>().is_valid() == false);
+    CHECK(t.get_method("set_value").get_invoker<void(typed_invoker_test&, int&)>().is_valid() == false);
+    // wrong return type
+    CHECK(t.get_method("get_value").get_invoker<long(typed_invoker_test&)>().is_valid() == false);
+    // missing object
+    CHECK(t.get_method("get_value").get_invoker<int()>().is_valid() == false);
+    // non const member function with const object
+    CHECK(t.get_method("set_value").get_invoker<void(const typed_invoker_test&, int)>().is_valid() == false);
+    // static function with object
+    CHECK(t.get_method("add").get_invoker<int(typed_invoker_test&, int, int)>().is_valid() == false);
+
+    method invalid_meth = type::get_by_name("").get_method("");
+    CHECK(invalid_meth.get_invoker<void()>().is_valid() == false);
+
+    typed_invoker<void()> default_invoker;
+    CHECK(default_invoker.is_valid() == false);
+    CHECK(default_invoker == invalid_meth.get_invoker<void()>());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("method - get_invoker - does not register types", "[method]")
+{
+    type t = type::get<typed_invoker_test>();
+    const auto type_count = type::get_types().size();
+
+    // the signature is compared without creating a type for the function pointer of the thunk
+    CHECK(t.get_method("add").get_invoker<short(short, short, short)>().is_valid() == false);
+    CHECK(t.get_method("base_func").get_invoker<int(const typed_invoker_test&, int)>().is_valid() == true);
+    CHECK(type::get_types().size() == type_count);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,332 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <catch/catch.hpp>
+
+#include <rttr/type>
+#include <rttr/registration>
+#include <rttr/access_plan.h>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+enum class access_plan_color
+{
+    red,
+    green
+};
+
+struct access_plan_leaf
+{
+    int         value = 0;
+    std::string text;
+};
+
+struct access_plan_list_node
+{
+    int                     value = 0;
+    access_plan_list_node*  next = nullptr;
+};
+
+struct access_plan_test
+{
+    bool                            bool_value = false;
+    char                            char_value = 'a';
+    int8_t                          int8_value = 0;
+    int16_t                         int16_value = 0;
+    int32_t                         int32_value = 0;
+    long long                       int64_value = 0;
+    unsigned int                    uint32_value = 0;
+    uint64_t                        uint64_value = 0;
+    float                           float_value = 0.0f;
+    double                          double_value = 0.0;
+    access_plan_color               color = access_plan_color::red;
+    std::string                     text;
+    std::vector<int>                int_list;
+    std::map<int, std::string>      int_map;
+    access_plan_leaf                leaf;
+    access_plan_leaf*               leaf_ptr = nullptr;
+    std::shared_ptr<access_plan_leaf> leaf_shared;
+    std::shared_ptr<int>            int_shared;
+    access_plan_list_node           list;
+    std::vector<access_plan_leaf>   leaf_list;
+
+    int get_value() const { return int32_value; }
+    void set_value(int value) { int32_value = value; }
+};
+
+struct access_plan_late_test
+{
+    int value_1 = 0;
+    int value_2 = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<access_plan_leaf>("access_plan_leaf")
+        .property("value", &access_plan_leaf::value)
+        .property("text", &access_plan_leaf::text);
+
+    registration::class_<access_plan_list_node>("access_plan_list_node")
+        .property("value", &access_plan_list_node::value)
+        .property("next", &access_plan_list_node::next);
+
+    registration::class_<access_plan_test>("access_plan_test")
+        .property("bool_value", &access_plan_test::bool_value)
+        .property("char_value", &access_plan_test::char_value)
+        .property("int8_value", &access_plan_test::int8_value)
+        .property("int16_value", &access_plan_test::int16_value)
+        .property("int32_value", &access_plan_test::int32_value)
+        .property("int64_value", &access_plan_test::int64_value)
+        .property("uint32_value", &access_plan_test::uint32_value)
+        .property("uint64_value", &access_plan_test::uint64_value)
+        .property("float_value", &access_plan_test::float_value)
+        .property("double_value", &access_plan_test::double_value)
+        .property("color", &access_plan_test::color)
+        .property("text", &access_plan_test::text)
+        .property("int_list", &access_plan_test::int_list)
+        .property("int_map", &access_plan_test::int_map)
+        .property("leaf", &access_plan_test::leaf)
+        .property("leaf_ptr", &access_plan_test::leaf_ptr)
+        .property("leaf_shared", &access_plan_test::leaf_shared)
+        .property("int_shared", &access_plan_test::int_shared)
+        .property("list", &access_plan_test::list)
+        .property("leaf_list", &access_plan_test::leaf_list)
+        .property("value", &access_plan_test::get_value, &access_plan_test::set_value)
+        .property("private_value", &access_plan_test::int32_value, registration::private_access);
+
+    registration::enumeration<access_plan_color>("access_plan_color")
+    (
+        value("red", access_plan_color::red),
+        value("green", access_plan_color::green)
+    );
+
+    registration::class_<access_plan_late_test>("access_plan_late_test")
+        .property("value_1", &access_plan_late_test::value_1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::vector<access_plan_entry> get_entry_list(const access_plan& plan)
+{
+    return std::vector<access_plan_entry>(plan.get_entries().begin(), plan.get_entries().end());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("access_plan - get_kind()", "[access_plan]")
+{
+    CHECK(access_plan::get_kind(type::get<bool>())                      == access_kind::boolean);
+    CHECK(access_plan::get_kind(type::get<char>())                      == access_kind::character);
+    CHECK(access_plan::get_kind(type::get<int8_t>())                    == access_kind::int8);
+    CHECK(access_plan::get_kind(type::get<long>())                      == (sizeof(long) == 8 ? access_kind::int64 : access_kind::int32));
+    CHECK(access_plan::get_kind(type::get<unsigned long long>())        == access_kind::uint64);
+    CHECK(access_plan::get_kind(type::get<double>())                    == access_kind::float64);
+    CHECK(access_plan::get_kind(type::get<long double>())               == access_kind::other);
+    CHECK(access_plan::get_kind(type::get<access_plan_color>())         == access_kind::enumeration);
+    CHECK(access_plan::get_kind(type::get<std::string>())               == access_kind::string);
+    CHECK(access_plan::get_kind(type::get<std::vector<int>>())          == access_kind::sequential_container);
+    CHECK(access_plan::get_kind(type::get<std::map<int, int>>())        == access_kind::associative_container);
+    CHECK(access_plan::get_kind(type::get<std::shared_ptr<int>>())      == access_kind::wrapper);
+    CHECK(access_plan::get_kind(type::get<access_plan_leaf*>())         == access_kind::pointer);
+    CHECK(access_plan::get_kind(type::get<void(*)(int)>())              == access_kind::other);
+    CHECK(access_plan::get_kind(type::get<access_plan_leaf>())          == access_kind::object);
+    CHECK(access_plan::get_kind(type::get_by_name(""))                  == access_kind::other);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("access_plan - get()", "[access_plan]")
+{
+    access_plan plan = access_plan::get(type::get<access_plan_test>());
+    REQUIRE(plan.is_valid() == true);
+    REQUIRE(static_cast<bool>(plan) == true);
+    CHECK(plan.get_type() == type::get<access_plan_test>());
+
+    SECTION("entries have the order of the public properties")
+    {
+        auto prop_list = type::get<access_plan_test>().get_properties();
+        auto entry_list = get_entry_list(plan);
+        REQUIRE(entry_list.size() == prop_list.size());
+
+        auto itr = entry_list.begin();
+        for (const auto& prop : prop_list)
+        {
+            CHECK(itr->get_property() == prop);
+            CHECK(itr->get_value_type() == prop.get_type());
+            ++itr;
+        }
+    }
+
+    SECTION("access kinds")
+    {
+        const std::vector<access_kind> expected_kinds =
+        {
+            access_kind::boolean, access_kind::character, access_kind::int8, access_kind::int16, access_kind::int32,
+            access_kind::int64, access_kind::uint32, access_kind::uint64, access_kind::float32, access_kind::float64,
+            access_kind::enumeration, access_kind::string, access_kind::sequential_container,
+            access_kind::associative_container, access_kind::object, access_kind::pointer, access_kind::wrapper,
+            access_kind::wrapper, access_kind::object, access_kind::sequential_container, access_kind::int32
+        };
+
+        auto entry_list = get_entry_list(plan);
+        REQUIRE(entry_list.size() == expected_kinds.size());
+        for (std::size_t i = 0; i < entry_list.size(); ++i)
+        {
+            INFO(entry_list[i].get_property().get_name());
+            CHECK(entry_list[i].get_kind() == expected_kinds[i]);
+        }
+
+        CHECK(entry_list[16].get_wrapped_kind() == access_kind::pointer);
+        CHECK(entry_list[17].get_wrapped_kind() == access_kind::pointer);
+        CHECK(entry_list[4].get_wrapped_kind() == access_kind::int32);
+    }
+
+    SECTION("offsets")
+    {
+        auto entry_list = get_entry_list(plan);
+        CHECK(entry_list[4].has_offset() == true);
+        CHECK(entry_list[4].get_offset() == entry_list[4].get_property().get_offset());
+        CHECK(entry_list.back().has_offset() == false);
+        CHECK(entry_list.back().get_offset() == 0);
+    }
+
+    SECTION("nested plans")
+    {
+        auto entry_list = get_entry_list(plan);
+        const auto leaf_plan = access_plan::get(type::get<access_plan_leaf>());
+        CHECK(entry_list[14].get_nested_plan() == leaf_plan);
+        CHECK(entry_list[15].get_nested_plan() == leaf_plan);
+        CHECK(entry_list[16].get_nested_plan() == leaf_plan);
+        CHECK(entry_list[17].get_nested_plan().is_valid() == false);
+        CHECK(entry_list[19].get_nested_plan() == leaf_plan);
+        CHECK(entry_list[12].get_nested_plan().is_valid() == false);
+        CHECK(entry_list[11].get_nested_plan().is_valid() == false);
+
+        REQUIRE(leaf_plan.get_entries().size() == 2);
+        CHECK(leaf_plan.get_entries().begin()->get_kind() == access_kind::int32);
+    }
+
+    SECTION("recursive type")
+    {
+        auto list_plan = get_entry_list(plan)[18].get_nested_plan();
+        REQUIRE(list_plan.is_valid() == true);
+        CHECK(list_plan.get_type() == type::get<access_plan_list_node>());
+
+        auto list_entries = get_entry_list(list_plan);
+        REQUIRE(list_entries.size() == 2);
+        CHECK(list_entries[1].get_kind() == access_kind::pointer);
+        CHECK(list_entries[1].get_nested_plan() == list_plan);
+    }
+
+    SECTION("member address")
+    {
+        access_plan_test obj;
+        auto entry_list = get_entry_list(plan);
+        CHECK(entry_list[4].get_member_address(obj) == &obj.int32_value);
+        CHECK(entry_list[11].get_member_address(obj) == &obj.text);
+        CHECK(entry_list.back().get_member_address(obj) == nullptr);
+
+        access_plan_test* obj_ptr = &obj;
+        CHECK(entry_list[4].get_member_address(obj_ptr) == &obj.int32_value);
+
+        access_plan_leaf other;
+        CHECK(entry_list[4].get_member_address(other) == nullptr);
+        CHECK(entry_list[4].get_member_address(instance()) == nullptr);
+
+        instance leaf = entry_list[14].get_member(obj);
+        REQUIRE(leaf.is_valid() == true);
+        CHECK(leaf.get_type() == type::get<access_plan_leaf>());
+        CHECK(leaf.try_convert<access_plan_leaf>() == &obj.leaf);
+        CHECK(entry_list.back().get_member(obj).is_valid() == false);
+    }
+
+    SECTION("fingerprint")
+    {
+        const auto leaf_plan = access_plan::get(type::get<access_plan_leaf>());
+        CHECK(plan.get_fingerprint() != 0);
+        CHECK(plan.get_fingerprint() != leaf_plan.get_fingerprint());
+        CHECK(get_entry_list(plan)[14].get_nested_plan().get_fingerprint() == leaf_plan.get_fingerprint());
+
+        auto list_plan = get_entry_list(plan)[18].get_nested_plan();
+        CHECK(list_plan.get_fingerprint() != 0);
+        CHECK(list_plan.get_fingerprint() == get_entry_list(list_plan)[1].get_nested_plan().get_fingerprint());
+    }
+
+    SECTION("cached")
+    {
+        CHECK(access_plan::get(type::get<access_plan_test>()) == plan);
+        CHECK(access_plan::get(type::get<access_plan_test*>()) == plan);
+        CHECK(access_plan::get(type::get<const access_plan_test>()) == plan);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("access_plan - invalidated by registration", "[access_plan]")
+{
+    access_plan plan = access_plan::get(type::get<access_plan_late_test>());
+    REQUIRE(plan.get_entries().size() == 1);
+
+    registration::class_<access_plan_late_test>("access_plan_late_test")
+        .property("value_2", &access_plan_late_test::value_2);
+
+    access_plan new_plan = access_plan::get(type::get<access_plan_late_test>());
+    CHECK(new_plan != plan);
+    CHECK(new_plan.get_entries().size() == 2);
+    CHECK(new_plan.get_fingerprint() != plan.get_fingerprint());
+
+    // the old plan is still alive
+    CHECK(plan.get_entries().size() == 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("access_plan - invalid", "[access_plan]")
+{
+    access_plan plan;
+    CHECK(plan.is_valid() == false);
+    CHECK(static_cast<bool>(plan) == false);
+    CHECK(plan.get_type().is_valid() == false);
+    CHECK(plan.get_entries().empty() == true);
+    CHECK(plan.get_fingerprint() == 0);
+
+    CHECK(access_plan::get(type::get_by_name("")).is_valid() == false);
+    CHECK(access_plan::get(type::get<int>()).is_valid() == true);
+    CHECK(access_plan::get(type::get<int>()).get_entries().empty() == true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,318 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <catch/catch.hpp>
+
+#include <rttr/type>
+#include <rttr/registration>
+#include <rttr/binary_serialization.h>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+enum class binary_color : std::uint8_t
+{
+    red     = 1,
+    green   = 2,
+    blue    = 200
+};
+
+struct binary_point
+{
+    binary_point() {}
+    binary_point(float x_, float y_) : x(x_), y(y_) {}
+
+    bool operator==(const binary_point& other) const { return (x == other.x && y == other.y); }
+    bool operator<(const binary_point& other) const { return (x < other.x || (x == other.x && y < other.y)); }
+
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+struct binary_test
+{
+    bool                                bool_value = false;
+    char                                char_value = 'a';
+    int16_t                             int16_value = 0;
+    long long                           int64_value = 0;
+    uint32_t                            uint32_value = 0;
+    double                              double_value = 0.0;
+    binary_color                        color = binary_color::red;
+    std::string                         text;
+    std::vector<int>                    int_list;
+    std::vector<std::string>            text_list;
+    std::vector<std::vector<int>>       nested_list;
+    std::map<std::string, int>          text_map;
+    std::set<int>                       int_set;
+    std::map<int, binary_point>         point_map;
+    binary_point                        point;
+    binary_point*                       point_ptr = nullptr;
+    std::shared_ptr<binary_point>       point_shared;
+    std::vector<binary_point>           point_list;
+    int                                 readonly_value = 0;
+
+    int get_value() const { return m_value; }
+    void set_value(int value) { m_value = value; }
+
+    int m_value = 0;
+};
+
+struct binary_other
+{
+    int value = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::enumeration<binary_color>("binary_color")
+    (
+        value("red",    binary_color::red),
+        value("green",  binary_color::green),
+        value("blue",   binary_color::blue)
+    );
+
+    registration::class_<binary_point>("binary_point")
+        .constructor<>()(policy::ctor::as_object)
+        .property("x", &binary_point::x)
+        .property("y", &binary_point::y);
+
+    registration::class_<binary_test>("binary_test")
+        .property("bool_value", &binary_test::bool_value)
+        .property("char_value", &binary_test::char_value)
+        .property("int16_value", &binary_test::int16_value)
+        .property("int64_value", &binary_test::int64_value)
+        .property("uint32_value", &binary_test::uint32_value)
+        .property("double_value", &binary_test::double_value)
+        .property("color", &binary_test::color)
+        .property("text", &binary_test::text)
+        .property("int_list", &binary_test::int_list)
+        .property("text_list", &binary_test::text_list)
+        .property("nested_list", &binary_test::nested_list)
+        .property("text_map", &binary_test::text_map)
+        .property("int_set", &binary_test::int_set)
+        .property("point_map", &binary_test::point_map)
+        .property("point", &binary_test::point)
+        .property("point_ptr", &binary_test::point_ptr)
+        .property("point_shared", &binary_test::point_shared)
+        .property("point_list", &binary_test::point_list)
+        .property_readonly("readonly_value", &binary_test::readonly_value)
+        .property("value", &binary_test::get_value, &binary_test::set_value);
+
+    registration::class_<binary_other>("binary_other")
+        .property("value", &binary_other::value);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static binary_test create_binary_test()
+{
+    binary_test obj;
+    obj.bool_value      = true;
+    obj.char_value      = 'z';
+    obj.int16_value     = -1234;
+    obj.int64_value     = -12345678901234LL;
+    obj.uint32_value    = 4000000000u;
+    obj.double_value    = 3.25;
+    obj.color           = binary_color::blue;
+    obj.text            = "hello world";
+    obj.int_list        = {1, 2, 3};
+    obj.text_list       = {"a", "", "ccc"};
+    obj.nested_list     = {{1}, {}, {2, 3}};
+    obj.text_map        = {{"one", 1}, {"two", 2}};
+    obj.int_set         = {5, 7};
+    obj.point_map       = {{1, binary_point(1.0f, 2.0f)}, {3, binary_point(3.0f, 4.0f)}};
+    obj.point           = binary_point(5.0f, 6.0f);
+    obj.point_shared    = std::make_shared<binary_point>(7.0f, 8.0f);
+    obj.point_list      = {binary_point(9.0f, 10.0f), binary_point(11.0f, 12.0f)};
+    obj.readonly_value  = 42;
+    obj.set_value(23);
+    return obj;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("binary serialization - round trip", "[binary_serialization]")
+{
+    binary_point source_target(13.0f, 14.0f);
+    binary_test source = create_binary_test();
+    source.point_ptr = &source_target;
+
+    std::vector<std::uint8_t> buffer;
+    REQUIRE(to_binary(source, buffer) == true);
+    CHECK(buffer.size() > 0);
+
+    binary_point target_point;
+    binary_test target;
+    target.point_ptr = &target_point;
+    target.point_shared = std::make_shared<binary_point>();
+    target.int_list = {9, 9, 9, 9, 9};
+    target.text_map = {{"old", 0}};
+    REQUIRE(from_binary(buffer.data(), buffer.size(), target) == true);
+
+    CHECK(target.bool_value == true);
+    CHECK(target.char_value == 'z');
+    CHECK(target.int16_value == -1234);
+    CHECK(target.int64_value == -12345678901234LL);
+    CHECK(target.uint32_value == 4000000000u);
+    CHECK(target.double_value == 3.25);
+    CHECK(target.color == binary_color::blue);
+    CHECK(target.text == "hello world");
+    CHECK(target.int_list == source.int_list);
+    CHECK(target.text_list == source.text_list);
+    CHECK(target.nested_list == source.nested_list);
+    CHECK(target.text_map == source.text_map);
+    CHECK(target.int_set == source.int_set);
+    CHECK(target.point_map == source.point_map);
+    CHECK(target.point == source.point);
+    CHECK(target_point == source_target);
+    CHECK(*target.point_shared == *source.point_shared);
+    CHECK(target.point_list == source.point_list);
+    CHECK(target.get_value() == 23);
+
+    // read only properties are not modified
+    CHECK(target.readonly_value == 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("binary serialization - null pointer", "[binary_serialization]")
+{
+    binary_test source = create_binary_test();
+    source.point_shared.reset();
+
+    std::vector<std::uint8_t> buffer;
+    REQUIRE(to_binary(source, buffer) == true);
+
+    binary_point target_point(1.0f, 1.0f);
+    binary_test target;
+    target.point_ptr = &target_point;
+    REQUIRE(from_binary(buffer.data(), buffer.size(), target) == true);
+
+    // a null pointer is written, so the object pointed to is not touched
+    CHECK(target_point == binary_point(1.0f, 1.0f));
+    CHECK(target.point_ptr == &target_point);
+    CHECK(target.point_shared.get() == nullptr);
+
+    // the data contains an object, but there is no target object
+    source.point_ptr = &target_point;
+    buffer.clear();
+    REQUIRE(to_binary(source, buffer) == true);
+    binary_test target_2;
+    CHECK(from_binary(buffer.data(), buffer.size(), target_2) == true);
+    CHECK(target_2.point_ptr == nullptr);
+    CHECK(target_2.point_list == source.point_list);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("binary serialization - append to buffer", "[binary_serialization]")
+{
+    binary_other first;
+    first.value = 1;
+    binary_other second;
+    second.value = 2;
+
+    std::vector<std::uint8_t> buffer;
+    REQUIRE(to_binary(first, buffer) == true);
+    const auto first_size = buffer.size();
+    REQUIRE(to_binary(second, buffer) == true);
+    CHECK(buffer.size() == 2 * first_size);
+
+    binary_other target;
+    REQUIRE(from_binary(buffer.data() + first_size, first_size, target) == true);
+    CHECK(target.value == 2);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("binary serialization - fingerprint", "[binary_serialization]")
+{
+    const auto fingerprint = access_plan::get(type::get<binary_test>()).get_fingerprint();
+    CHECK(fingerprint != 0);
+    CHECK(fingerprint == access_plan::get(type::get<binary_test>()).get_fingerprint());
+    CHECK(fingerprint != access_plan::get(type::get<binary_other>()).get_fingerprint());
+    CHECK(access_plan::get(type::get<binary_point>()).get_fingerprint() != access_plan::get(type::get<binary_other>()).get_fingerprint());
+
+    binary_test source = create_binary_test();
+    std::vector<std::uint8_t> buffer;
+    REQUIRE(to_binary(source, buffer) == true);
+
+    // the data was written for another type
+    binary_other other;
+    other.value = 12;
+    CHECK(from_binary(buffer.data(), buffer.size(), other) == false);
+    CHECK(other.value == 12);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("binary serialization - NEGATIVE", "[binary_serialization]")
+{
+    binary_test source = create_binary_test();
+    std::vector<std::uint8_t> buffer;
+    REQUIRE(to_binary(source, buffer) == true);
+
+    SECTION("truncated data")
+    {
+        for (std::size_t size = 0; size < buffer.size(); ++size)
+        {
+            binary_test target;
+            CHECK(from_binary(buffer.data(), size, target) == false);
+        }
+    }
+
+    SECTION("wrong magic")
+    {
+        buffer[0] = 'X';
+        binary_test target;
+        CHECK(from_binary(buffer.data(), buffer.size(), target) == false);
+        CHECK(target.text.empty() == true);
+    }
+
+    SECTION("invalid arguments")
+    {
+        binary_test target;
+        CHECK(from_binary(nullptr, buffer.size(), target) == false);
+        CHECK(from_binary(buffer.data(), buffer.size(), instance()) == false);
+
+        std::vector<std::uint8_t> empty_buffer;
+        CHECK(to_binary(instance(), empty_buffer) == false);
+        CHECK(empty_buffer.empty() == true);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,303 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <catch/catch.hpp>
+
+#include <rttr/type>
+#include <rttr/registration>
+#include <rttr/binary_serialization.h>
+#include <rttr/binary_view.h>
+#include <rttr/mapped_file.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct view_point
+{
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+struct view_node
+{
+    std::string                 name;
+    int                         id = 0;
+    view_point                  position;
+    std::shared_ptr<view_point> pivot;
+};
+
+struct view_scene
+{
+    std::string                 title;
+    double                      scale = 1.0;
+    std::vector<int>            tags;
+    std::vector<view_node>      nodes;
+    std::vector<view_point*>    markers;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<view_point>("view_point")
+        .constructor<>()(policy::ctor::as_object)
+        .property("x", &view_point::x)
+        .property("y", &view_point::y);
+
+    registration::class_<view_node>("view_node")
+        .property("name", &view_node::name)
+        .property("id", &view_node::id)
+        .property("position", &view_node::position)
+        .property("pivot", &view_node::pivot);
+
+    registration::class_<view_scene>("view_scene")
+        .property("title", &view_scene::title)
+        .property("scale", &view_scene::scale)
+        .property("tags", &view_scene::tags)
+        .property("nodes", &view_scene::nodes)
+        .property("markers", &view_scene::markers);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static std::vector<std::uint8_t> create_view_scene_data(view_point& marker)
+{
+    view_scene scene;
+    scene.title = "level one";
+    scene.scale = 2.5;
+    scene.tags  = {3, 5, 8};
+    for (int i = 0; i < 3; ++i)
+    {
+        view_node node;
+        node.name       = "node " + std::to_string(i);
+        node.id         = i * 10;
+        node.position.x = static_cast<float>(i);
+        node.position.y = static_cast<float>(i) + 0.5f;
+        if (i == 1)
+            node.pivot = std::make_shared<view_point>(node.position);
+        scene.nodes.push_back(node);
+    }
+    marker.x = 7.0f;
+    marker.y = 8.0f;
+    scene.markers = {nullptr, &marker};
+
+    std::vector<std::uint8_t> buffer;
+    to_binary(scene, buffer);
+    return buffer;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("binary_view - values", "[binary_view]")
+{
+    view_point marker;
+    const auto buffer = create_view_scene_data(marker);
+    REQUIRE(buffer.size() > 0);
+
+    binary_view scene(buffer.data(), buffer.size(), type::get<view_scene>());
+    REQUIRE(scene.is_valid() == true);
+    CHECK(static_cast<bool>(scene) == true);
+    CHECK(scene.get_type() == type::get<view_scene>());
+    CHECK(scene.get_size() < buffer.size());
+
+    CHECK(scene.has_value("title") == true);
+    CHECK(scene.has_value("unknown") == false);
+
+    const auto title = scene.get_string("title");
+    CHECK(title == "level one");
+    CHECK(title.data() > reinterpret_cast<const char*>(buffer.data()));
+    CHECK(title.data() < reinterpret_cast<const char*>(buffer.data() + buffer.size()));
+
+    variant scale = scene.get_value("scale");
+    REQUIRE(scale.is_type<double>() == true);
+    CHECK(scale.get_value<double>() == 2.5);
+
+    variant title_value = scene.get_value("title");
+    REQUIRE(title_value.is_type<std::string>() == true);
+    CHECK(title_value.get_value<std::string>() == "level one");
+
+    CHECK(scene.get_item_count("tags") == 3);
+    CHECK(scene.get_item_count("nodes") == 3);
+    CHECK(scene.get_item_count("title") == 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("binary_view - nested objects", "[binary_view]")
+{
+    view_point marker;
+    const auto buffer = create_view_scene_data(marker);
+    binary_view scene(buffer.data(), buffer.size(), type::get<view_scene>());
+    REQUIRE(scene.is_valid() == true);
+
+    SECTION("items")
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            binary_view node = scene.get_item("nodes", static_cast<std::size_t>(i));
+            REQUIRE(node.is_valid() == true);
+            CHECK(node.get_type() == type::get<view_node>());
+            CHECK(node.get_string("name") == "node " + std::to_string(i));
+            CHECK(node.get_value("id").get_value<int>() == i * 10);
+
+            binary_view position = node.get_object("position");
+            REQUIRE(position.is_valid() == true);
+            CHECK(position.get_value("x").get_value<float>() == static_cast<float>(i));
+
+            // objects with a default constructor are materialized
+            variant position_value = node.get_value("position");
+            REQUIRE(position_value.is_type<view_point>() == true);
+            CHECK(position_value.get_value<view_point>().y == static_cast<float>(i) + 0.5f);
+
+            CHECK(node.get_object("pivot").is_valid() == (i == 1));
+        }
+
+        CHECK(scene.get_item("nodes", 3).is_valid() == false);
+        CHECK(scene.get_item("tags", 0).is_valid() == false);
+    }
+
+    SECTION("pointer items")
+    {
+        CHECK(scene.get_item("markers", 0).is_valid() == false);
+        binary_view item = scene.get_item("markers", 1);
+        REQUIRE(item.is_valid() == true);
+        CHECK(item.get_value("x").get_value<float>() == 7.0f);
+        CHECK(item.get_value("y").get_value<float>() == 8.0f);
+    }
+
+    SECTION("read")
+    {
+        view_node node;
+        node.pivot = std::make_shared<view_point>();
+        REQUIRE(scene.get_item("nodes", 1).read(node) == true);
+        CHECK(node.name == "node 1");
+        CHECK(node.id == 10);
+        CHECK(node.position.x == 1.0f);
+        CHECK(node.pivot->y == 1.5f);
+
+        view_point point;
+        CHECK(scene.get_item("nodes", 1).read(point) == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("binary_view - mapped_file", "[binary_view]")
+{
+    view_point marker;
+    const auto buffer = create_view_scene_data(marker);
+    const char* file_name = "binary_view_test.bin";
+    {
+        std::ofstream stream(file_name, std::ios::binary);
+        stream.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    }
+
+    {
+        mapped_file file(file_name);
+        CHECK(file.is_open() == false);
+        CHECK(file.get_file_name() == file_name);
+        REQUIRE(file.open() == true);
+        CHECK(file.is_open() == true);
+        CHECK(file.get_error_string().empty() == true);
+        REQUIRE(file.get_size() == buffer.size());
+
+        binary_view scene(file.get_data(), file.get_size(), type::get<view_scene>());
+        REQUIRE(scene.is_valid() == true);
+        CHECK(scene.get_string("title") == "level one");
+        CHECK(scene.get_item("nodes", 2).get_string("name") == "node 2");
+
+        CHECK(file.close() == true);
+        CHECK(file.is_open() == false);
+        CHECK(file.get_data() == nullptr);
+    }
+
+    std::remove(file_name);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("binary_view - NEGATIVE", "[binary_view]")
+{
+    view_point marker;
+    const auto buffer = create_view_scene_data(marker);
+
+    SECTION("invalid view")
+    {
+        binary_view view;
+        CHECK(view.is_valid() == false);
+        CHECK(view.get_type().is_valid() == false);
+        CHECK(view.get_size() == 0);
+        CHECK(view.has_value("title") == false);
+        CHECK(view.get_string("title").empty() == true);
+        CHECK(view.get_value("title").is_valid() == false);
+        CHECK(view.get_object("title").is_valid() == false);
+        CHECK(view.get_item_count("nodes") == 0);
+        view_scene scene;
+        CHECK(view.read(scene) == false);
+    }
+
+    SECTION("wrong type")
+    {
+        binary_view view(buffer.data(), buffer.size(), type::get<view_node>());
+        CHECK(view.is_valid() == false);
+    }
+
+    SECTION("truncated data")
+    {
+        CHECK(binary_view(buffer.data(), 10, type::get<view_scene>()).is_valid() == false);
+        CHECK(binary_view(buffer.data(), buffer.size() - 1, type::get<view_scene>()).is_valid() == false);
+        CHECK(binary_view(nullptr, buffer.size(), type::get<view_scene>()).is_valid() == false);
+    }
+
+    SECTION("wrong kind")
+    {
+        binary_view scene(buffer.data(), buffer.size(), type::get<view_scene>());
+        CHECK(scene.get_string("scale").empty() == true);
+        CHECK(scene.get_object("title").is_valid() == false);
+        CHECK(scene.get_item("title", 0).is_valid() == false);
+    }
+
+    SECTION("missing file")
+    {
+        mapped_file file("binary_view_test_missing.bin");
+        CHECK(file.open() == false);
+        CHECK(file.is_open() == false);
+        CHECK(file.get_error_string().empty() == false);
+        CHECK(file.get_data() == nullptr);
+        CHECK(file.get_size() == 0);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,287 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <catch/catch.hpp>
+
+#include <rttr/type>
+#include <rttr/registration>
+#include <rttr/json_serialization.h>
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace rttr;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+enum class json_color
+{
+    red,
+    green,
+    blue
+};
+
+struct json_point
+{
+    bool operator==(const json_point& other) const { return (x == other.x && y == other.y); }
+    bool operator<(const json_point& other) const { return (x < other.x || (x == other.x && y < other.y)); }
+
+    double x = 0.0;
+    double y = 0.0;
+};
+
+struct json_test
+{
+    bool                                bool_value = false;
+    std::int8_t                         int8_value = 0;
+    int                                 int_value = 0;
+    std::uint64_t                       uint64_value = 0;
+    float                               float_value = 0.0f;
+    double                              double_value = 0.0;
+    json_color                          color = json_color::red;
+    std::string                         text;
+    std::vector<int>                    int_list;
+    std::vector<std::vector<int>>       nested_list;
+    std::array<int, 2>                  int_array = {{0, 0}};
+    std::map<std::string, int>          text_map;
+    std::set<int>                       int_set;
+    std::map<int, json_point>           point_map;
+    json_point                          point;
+    json_point*                         point_ptr = nullptr;
+    std::shared_ptr<json_point>         point_shared;
+    std::vector<json_point>             point_list;
+    int                                 readonly_value = 0;
+
+    int get_value() const { return m_value; }
+    void set_value(int value) { m_value = value; }
+
+    json_point get_point() const { return m_point; }
+    void set_point(const json_point& point) { m_point = point; }
+
+    int         m_value = 0;
+    json_point  m_point;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::enumeration<json_color>("json_color")
+    (
+        value("red",    json_color::red),
+        value("green",  json_color::green),
+        value("blue",   json_color::blue)
+    );
+
+    registration::class_<json_point>("json_point")
+        .constructor<>()(policy::ctor::as_object)
+        .property("x", &json_point::x)
+        .property("y", &json_point::y);
+
+    registration::class_<json_test>("json_test")
+        .property("bool_value", &json_test::bool_value)
+        .property("int8_value", &json_test::int8_value)
+        .property("int_value", &json_test::int_value)
+        .property("uint64_value", &json_test::uint64_value)
+        .property("float_value", &json_test::float_value)
+        .property("double_value", &json_test::double_value)
+        .property("color", &json_test::color)
+        .property("text", &json_test::text)
+        .property("int_list", &json_test::int_list)
+        .property("nested_list", &json_test::nested_list)
+        .property("int_array", &json_test::int_array)
+        .property("text_map", &json_test::text_map)
+        .property("int_set", &json_test::int_set)
+        .property("point_map", &json_test::point_map)
+        .property("point", &json_test::point)
+        .property("point_ptr", &json_test::point_ptr)
+        .property("point_shared", &json_test::point_shared)
+        .property("point_list", &json_test::point_list)
+        .property_readonly("readonly_value", &json_test::readonly_value)
+        .property("value", &json_test::get_value, &json_test::set_value)
+        .property("point_value", &json_test::get_point, &json_test::set_point);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static const char* json_test_text = R"({
+    "bool_value": true,
+    "int8_value": -12,
+    "int_value": 123456,
+    "uint64_value": 18446744073709551615,
+    "float_value": 1.5,
+    "double_value": 3,
+    "color": "blue",
+    "text": "hello \"world\"",
+    "int_list": [1, 2, 3],
+    "nested_list": [[1], [], [2, 3]],
+    "int_array": [7, 8, 9],
+    "text_map": [{"key": "one", "value": 1}, {"value": 2, "key": "two"}],
+    "int_set": [5, 7],
+    "point_map": [{"key": 1, "value": {"x": 1.0, "y": 2.0}}],
+    "point": {"x": 5.0, "y": 6.0},
+    "point_ptr": {"x": 13.0, "y": 14.0},
+    "point_shared": {"x": 7.0, "y": 8.0},
+    "point_list": [{"x": 9.0, "y": 10.0}, {"y": 12.0, "x": 11.0}],
+    "readonly_value": 42,
+    "value": 23,
+    "point_value": {"x": 3.0, "y": 4.0}
+})";
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+static void check_json_test(const json_test& obj)
+{
+    CHECK(obj.bool_value == true);
+    CHECK(obj.int8_value == -12);
+    CHECK(obj.int_value == 123456);
+    CHECK(obj.uint64_value == 18446744073709551615ull);
+    CHECK(obj.float_value == 1.5f);
+    CHECK(obj.double_value == 3.0);
+    CHECK(obj.color == json_color::blue);
+    CHECK(obj.text == "hello \"world\"");
+    CHECK(obj.int_list == std::vector<int>({1, 2, 3}));
+    CHECK(obj.nested_list == std::vector<std::vector<int>>({{1}, {}, {2, 3}}));
+    // the array has a fixed size, the last value is ignored
+    CHECK(obj.int_array[0] == 7);
+    CHECK(obj.int_array[1] == 8);
+    CHECK(obj.text_map == std::map<std::string, int>({{"one", 1}, {"two", 2}}));
+    CHECK(obj.int_set == std::set<int>({5, 7}));
+    REQUIRE(obj.point_map.size() == 1);
+    CHECK(obj.point_map.at(1) == (json_point{1.0, 2.0}));
+    CHECK(obj.point == (json_point{5.0, 6.0}));
+    CHECK(obj.point_shared->x == 7.0);
+    REQUIRE(obj.point_list.size() == 2);
+    CHECK(obj.point_list[0] == (json_point{9.0, 10.0}));
+    CHECK(obj.point_list[1] == (json_point{11.0, 12.0}));
+    CHECK(obj.readonly_value == 0);
+    CHECK(obj.get_value() == 23);
+    CHECK(obj.get_point() == (json_point{3.0, 4.0}));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("json serialization - from_json", "[json_serialization]")
+{
+    json_point target_point;
+    json_test obj;
+    obj.point_ptr = &target_point;
+    obj.point_shared = std::make_shared<json_point>();
+    obj.int_list = {9, 9, 9, 9, 9};
+    obj.text_map = {{"old", 0}};
+    obj.point_list.resize(5);
+
+    REQUIRE(from_json(json_test_text, obj) == true);
+    check_json_test(obj);
+
+    // the object pointed to is updated in-place
+    CHECK(obj.point_ptr == &target_point);
+    CHECK(target_point == (json_point{13.0, 14.0}));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("json serialization - from_json with stream", "[json_serialization]")
+{
+    json_test obj;
+    obj.point_shared = std::make_shared<json_point>();
+
+    std::istringstream stream(json_test_text);
+    REQUIRE(from_json(stream, obj) == true);
+    check_json_test(obj);
+
+    // larger than the internal buffer of the stream
+    std::string json = "{\"text\": \"" + std::string(10000, 'a') + "\", \"int_list\": [";
+    for (int i = 0; i < 2000; ++i)
+        json += std::to_string(i) + (i + 1 < 2000 ? ", " : "]}");
+
+    std::istringstream large_stream(json);
+    REQUIRE(from_json(large_stream, obj) == true);
+    CHECK(obj.text == std::string(10000, 'a'));
+    REQUIRE(obj.int_list.size() == 2000);
+    CHECK(obj.int_list[1999] == 1999);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("json serialization - ignored values", "[json_serialization]")
+{
+    json_test obj;
+    obj.int_value = 1;
+    obj.int8_value = 2;
+    obj.text = "text";
+
+    const char* json = R"({
+        "unknown": {"int_value": 5, "list": [1, {"a": [2]}]},
+        "unknown_list": [[1, 2], {"int_value": 6}],
+        "int8_value": 300,
+        "text": 12,
+        "int_list": [1, "two", 3],
+        "point_ptr": {"x": 1.0},
+        "point_shared": null,
+        "int_value": 7
+    })";
+
+    REQUIRE(from_json(json, obj) == true);
+    CHECK(obj.int_value == 7);
+    // out of range
+    CHECK(obj.int8_value == 2);
+    CHECK(obj.text == "12");
+    CHECK(obj.int_list == std::vector<int>({1, 0, 3}));
+    CHECK(obj.point_ptr == nullptr);
+    CHECK(obj.point_shared.get() == nullptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("json serialization - from_json - NEGATIVE", "[json_serialization]")
+{
+    json_test obj;
+
+    CHECK(from_json("", obj) == false);
+    CHECK(from_json("[1, 2]", obj) == false);
+    CHECK(from_json("42", obj) == false);
+    CHECK(from_json(R"({"int_value": 5)", obj) == false);
+    CHECK(from_json(R"({"int_value": 5} {"int_value": 6})", obj) == false);
+
+    // the values before the error are kept
+    CHECK(from_json(R"({"int_value": 5, "text": })", obj) == false);
+    CHECK(obj.int_value == 5);
+
+    CHECK(from_json(R"({"int_value": 5})", instance()) == false);
+
+    std::istringstream stream(R"({"int_value": )");
+    CHECK(from_json(stream, obj) == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
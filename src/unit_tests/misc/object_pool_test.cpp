@@ -0,0 +1,302 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <catch/catch.hpp>
+
+#include <rttr/type>
+#include <rttr/registration>
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace rttr;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+struct object_pool_test
+{
+    object_pool_test() { ++ctor_count; }
+    ~object_pool_test() { ++dtor_count; }
+
+    double  value_1 = 1.0;
+    int     value_2 = 2;
+
+    static std::atomic<int> ctor_count;
+    static std::atomic<int> dtor_count;
+};
+
+std::atomic<int> object_pool_test::ctor_count(0);
+std::atomic<int> object_pool_test::dtor_count(0);
+
+struct object_pool_factory_test
+{
+    static object_pool_factory_test create() { return object_pool_factory_test(); }
+};
+
+struct object_pool_arg_test
+{
+    object_pool_arg_test(int) {}
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<object_pool_test>("object_pool_test")
+        .constructor<>()
+        .property("value_2", &object_pool_test::value_2);
+
+    registration::class_<object_pool_factory_test>("object_pool_factory_test")
+        .constructor(&object_pool_factory_test::create);
+
+    registration::class_<object_pool_arg_test>("object_pool_arg_test")
+        .constructor<int>();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("object_pool - create and destroy", "[object_pool]")
+{
+    object_pool pool(type::get<object_pool_test>(), 4);
+    REQUIRE(pool.is_valid() == true);
+    REQUIRE(static_cast<bool>(pool) == true);
+    CHECK(pool.get_type() == type::get<object_pool_test>());
+    CHECK(pool.get_capacity() == 0);
+
+    const int ctor_count = object_pool_test::ctor_count;
+    const int dtor_count = object_pool_test::dtor_count;
+
+    variant obj = pool.create();
+    REQUIRE(obj.is_type<object_pool_test*>() == true);
+    CHECK(pool.get_capacity() == 4);
+    CHECK(object_pool_test::ctor_count == ctor_count + 1);
+    CHECK(pool.get_type().get_property_value("value_2", obj) == 2);
+
+    object_pool_test* ptr = obj.get_value<object_pool_test*>();
+    CHECK(pool.destroy(obj) == true);
+    CHECK(obj.is_valid() == false);
+    CHECK(object_pool_test::dtor_count == dtor_count + 1);
+
+    // the storage is recycled
+    obj = pool.create();
+    CHECK(obj.get_value<object_pool_test*>() == ptr);
+    CHECK(pool.destroy(obj) == true);
+
+    std::vector<variant> objects;
+    for (int i = 0; i < 9; ++i)
+        objects.push_back(pool.create());
+
+    CHECK(pool.get_capacity() == 12);
+    for (auto& item : objects)
+        CHECK(pool.destroy(item) == true);
+
+    CHECK(object_pool_test::ctor_count == object_pool_test::dtor_count + (ctor_count - dtor_count));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("object_pool - negative", "[object_pool]")
+{
+    object_pool invalid_pool(type::get_by_name(""));
+    CHECK(invalid_pool.is_valid() == false);
+    CHECK(invalid_pool.create().is_valid() == false);
+
+    object_pool arg_pool(type::get<object_pool_arg_test>());
+    CHECK(arg_pool.is_valid() == false);
+    CHECK(arg_pool.create().is_valid() == false);
+
+    // a factory function cannot construct an object in the storage of the pool
+    object_pool factory_pool(type::get<object_pool_factory_test>());
+    CHECK(factory_pool.is_valid() == false);
+    CHECK(factory_pool.create().is_valid() == false);
+    CHECK(factory_pool.get_capacity() == 0);
+
+    object_pool pool(type::get<object_pool_test>());
+    variant obj = 23;
+    CHECK(pool.destroy(obj) == false);
+    CHECK(obj.is_valid() == true);
+
+    obj = static_cast<object_pool_test*>(nullptr);
+    CHECK(pool.destroy(obj) == false);
+
+    // an object which was not created by the pool is rejected
+    std::unique_ptr<object_pool_test> foreign(new object_pool_test);
+    obj = foreign.get();
+    CHECK(pool.destroy(obj) == false);
+    CHECK(obj.is_valid() == true);
+
+    object_pool other_pool(type::get<object_pool_test>());
+    obj = other_pool.create();
+    CHECK(pool.destroy(obj) == false);
+    CHECK(other_pool.destroy(obj) == true);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("object_pool - multiple threads", "[object_pool]")
+{
+    object_pool pool(type::get<object_pool_test>(), 16);
+    const int ctor_count = object_pool_test::ctor_count;
+    const int dtor_count = object_pool_test::dtor_count;
+
+    const int thread_count = 4;
+    const int iterations = 1000;
+    std::atomic<int> error_count(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&pool, &error_count, t]()
+        {
+            std::vector<variant> objects;
+            for (int i = 0; i < iterations; ++i)
+            {
+                objects.push_back(pool.create());
+                objects.back().get_value<object_pool_test*>()->value_2 = t;
+
+                // destroy some objects in between, to recycle slots between the threads
+                if (i % 3 == 0)
+                {
+                    if (objects.front().get_value<object_pool_test*>()->value_2 != t || !pool.destroy(objects.front()))
+                        ++error_count;
+                    objects.erase(objects.begin());
+                }
+            }
+
+            for (auto& obj : objects)
+            {
+                if (obj.get_value<object_pool_test*>()->value_2 != t || !pool.destroy(obj))
+                    ++error_count;
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    CHECK(error_count == 0);
+    CHECK(object_pool_test::ctor_count - ctor_count == thread_count * iterations);
+    CHECK(object_pool_test::dtor_count - dtor_count == thread_count * iterations);
+    CHECK(pool.get_capacity() <= std::size_t(thread_count * iterations));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("object_pool - destroy in other thread", "[object_pool]")
+{
+    object_pool pool(type::get<object_pool_test>(), 8);
+
+    // the objects are created by short-lived threads and destroyed by other short-lived threads,
+    // the slots cached by a terminated thread have to be reused
+    const int object_count = 64;
+    std::atomic<int> error_count(0);
+    for (int round = 0; round < 50; ++round)
+    {
+        std::vector<variant> objects;
+        std::thread creator([&]()
+        {
+            for (int i = 0; i < object_count; ++i)
+                objects.push_back(pool.create());
+        });
+        creator.join();
+
+        std::thread destroyer([&]()
+        {
+            for (auto& obj : objects)
+            {
+                if (!pool.destroy(obj))
+                    ++error_count;
+            }
+        });
+        destroyer.join();
+    }
+
+    CHECK(error_count == 0);
+    // the blocks grow geometrically: 8 + 16 + 32 + 64 + 128
+    CHECK(pool.get_capacity() <= 248);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("object_pool - destroy in long-lived thread", "[object_pool]")
+{
+    object_pool pool(type::get<object_pool_test>(), 8);
+
+    // the main thread only destroys objects, its cached slots have to be given back
+    // to the creating thread, otherwise the pool would grow with every round
+    const int object_count = 64;
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::vector<variant> objects;
+    bool created = false;
+    bool finished = false;
+
+    std::thread creator([&]()
+    {
+        for (int round = 0; round < 100; ++round)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cond.wait(lock, [&]() { return !created; });
+            for (int i = 0; i < object_count; ++i)
+                objects.push_back(pool.create());
+            created = true;
+            cond.notify_all();
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        cond.wait(lock, [&]() { return !created; });
+        finished = true;
+        cond.notify_all();
+    });
+
+    int error_count = 0;
+    while (true)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cond.wait(lock, [&]() { return created || finished; });
+        if (finished)
+            break;
+
+        for (auto& obj : objects)
+        {
+            if (!pool.destroy(obj))
+                ++error_count;
+        }
+        objects.clear();
+        created = false;
+        cond.notify_all();
+    }
+    creator.join();
+
+    CHECK(error_count == 0);
+    CHECK(pool.get_capacity() <= 248);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,303 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/registration>
+#include <catch/catch.hpp>
+
+#include <array>
+#include <list>
+#include <string>
+#include <vector>
+
+using namespace rttr;
+using namespace std;
+
+struct batch_access_base
+{
+    virtual ~batch_access_base() {}
+    int base_value = 0;
+
+    RTTR_ENABLE()
+};
+
+struct batch_access_test : batch_access_base
+{
+    batch_access_test(int value = 0) : int_value(value), text_value(std::to_string(value)), m_func_value(value) {}
+
+    int get_func_value() const { return m_func_value; }
+    void set_func_value(int value) { m_func_value = value; }
+
+    int         int_value;
+    std::string text_value;
+    int         m_func_value;
+
+    RTTR_ENABLE(batch_access_base)
+};
+
+struct batch_access_other
+{
+    int int_value = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<batch_access_base>("batch_access_base")
+        .property("base_value", &batch_access_base::base_value)
+        ;
+
+    registration::class_<batch_access_test>("batch_access_test")
+        .property("int_value", &batch_access_test::int_value)
+        .property("text_value", &batch_access_test::text_value)
+        .property_readonly("int_value_ro", &batch_access_test::int_value)
+        .property("func_value", &batch_access_test::get_func_value, &batch_access_test::set_func_value)
+        .property("int_value_ptr", &batch_access_test::int_value)
+        (
+            policy::prop::bind_as_ptr
+        )
+        ;
+
+    registration::class_<batch_access_other>("batch_access_other")
+        .property("int_value", &batch_access_other::int_value)
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - get_values - instances", "[property]")
+{
+    std::vector<batch_access_test> objects = {batch_access_test(1), batch_access_test(2), batch_access_test(3)};
+    std::vector<instance> instances(objects.begin(), objects.end());
+    array_range<instance> range(instances.data(), instances.size());
+    type t = type::get<batch_access_test>();
+
+    SECTION("member object")
+    {
+        std::vector<int> values;
+        variant var = std::ref(values);
+        CHECK(t.get_property("int_value").get_values(range, var.create_sequential_view()) == true);
+        CHECK(values == std::vector<int>({1, 2, 3}));
+
+        std::vector<std::string> texts;
+        var = std::ref(texts);
+        CHECK(t.get_property("text_value").get_values(range, var.create_sequential_view()) == true);
+        CHECK(texts == std::vector<std::string>({"1", "2", "3"}));
+
+        values.clear();
+        var = std::ref(values);
+        CHECK(t.get_property("int_value_ro").get_values(range, var.create_sequential_view()) == true);
+        CHECK(values == std::vector<int>({1, 2, 3}));
+    }
+
+    SECTION("member function")
+    {
+        std::array<int, 3> values = {0, 0, 0};
+        variant var = std::ref(values);
+        CHECK(t.get_property("func_value").get_values(range, var.create_sequential_view()) == true);
+        CHECK(values[0] == 1);
+        CHECK(values[2] == 3);
+    }
+
+    SECTION("with policy")
+    {
+        std::vector<int*> values;
+        variant var = std::ref(values);
+        CHECK(t.get_property("int_value_ptr").get_values(range, var.create_sequential_view()) == true);
+        REQUIRE(values.size() == 3);
+        CHECK(values[1] == &objects[1].int_value);
+    }
+
+    SECTION("base property")
+    {
+        objects[2].base_value = 42;
+        std::vector<int> values;
+        variant var = std::ref(values);
+        CHECK(type::get<batch_access_base>().get_property("base_value").get_values(range, var.create_sequential_view()) == true);
+        CHECK(values == std::vector<int>({0, 0, 42}));
+    }
+
+    SECTION("NEGATIVE")
+    {
+        std::vector<double> values;
+        variant var = std::ref(values);
+        CHECK(t.get_property("int_value").get_values(range, var.create_sequential_view()) == false);
+
+        std::array<int, 2> small_values = {0, 0};
+        var = std::ref(small_values);
+        CHECK(t.get_property("int_value").get_values(range, var.create_sequential_view()) == false);
+
+        batch_access_other other;
+        std::vector<instance> wrong_instances = {objects[0], other};
+        std::vector<int> int_values = {-1};
+        var = std::ref(int_values);
+        CHECK(t.get_property("int_value").get_values({wrong_instances.data(), wrong_instances.size()},
+                                                     var.create_sequential_view()) == false);
+        // nothing was written before the wrong object was detected
+        CHECK(int_values == std::vector<int>({-1}));
+
+        std::array<int, 2> fixed_values = {-1, -1};
+        var = std::ref(fixed_values);
+        CHECK(t.get_property("int_value").get_values({wrong_instances.data(), wrong_instances.size()},
+                                                     var.create_sequential_view()) == false);
+        CHECK(fixed_values[0] == -1);
+
+        CHECK(t.get_property("int_value").get_values(range, variant().create_sequential_view()) == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - set_values - instances", "[property]")
+{
+    std::vector<batch_access_test> objects(3);
+    std::vector<instance> instances(objects.begin(), objects.end());
+    array_range<instance> range(instances.data(), instances.size());
+    type t = type::get<batch_access_test>();
+
+    SECTION("member object")
+    {
+        std::vector<int> values = {4, 5, 6};
+        variant var = std::ref(values);
+        CHECK(t.get_property("int_value").set_values(range, var.create_sequential_view()) == true);
+        CHECK(objects[0].int_value == 4);
+        CHECK(objects[2].int_value == 6);
+
+        std::vector<std::string> texts = {"a", "b", "c"};
+        var = std::ref(texts);
+        CHECK(t.get_property("text_value").set_values(range, var.create_sequential_view()) == true);
+        CHECK(objects[1].text_value == "b");
+    }
+
+    SECTION("member function")
+    {
+        std::vector<int> values = {7, 8, 9};
+        variant var = std::ref(values);
+        CHECK(t.get_property("func_value").set_values(range, var.create_sequential_view()) == true);
+        CHECK(objects[0].get_func_value() == 7);
+        CHECK(objects[2].get_func_value() == 9);
+    }
+
+    SECTION("const container")
+    {
+        const std::vector<int> values = {1, 2, 3};
+        variant var = std::cref(values);
+        CHECK(t.get_property("int_value").set_values(range, var.create_sequential_view()) == true);
+        CHECK(objects[1].int_value == 2);
+
+        const std::list<int> list_values = {4, 5, 6};
+        var = std::cref(list_values);
+        CHECK(t.get_property("func_value").set_values(range, var.create_sequential_view()) == true);
+        CHECK(objects[2].get_func_value() == 6);
+    }
+
+    SECTION("NEGATIVE")
+    {
+        std::vector<int> values = {1, 2, 3};
+        variant var = std::ref(values);
+        CHECK(t.get_property("int_value_ro").set_values(range, var.create_sequential_view()) == false);
+        CHECK(objects[0].int_value == 0);
+
+        std::vector<int> small_values = {1, 2};
+        var = std::ref(small_values);
+        CHECK(t.get_property("int_value").set_values(range, var.create_sequential_view()) == false);
+
+        std::vector<double> double_values = {1.0, 2.0, 3.0};
+        var = std::ref(double_values);
+        CHECK(t.get_property("int_value").set_values(range, var.create_sequential_view()) == false);
+        CHECK(objects[0].int_value == 0);
+
+        batch_access_other other;
+        std::vector<instance> wrong_instances = {objects[0], other};
+        std::vector<int> two_values = {1, 2};
+        var = std::ref(two_values);
+        CHECK(t.get_property("int_value").set_values({wrong_instances.data(), wrong_instances.size()},
+                                                     var.create_sequential_view()) == false);
+        // the first object was not modified, because all objects are checked first
+        CHECK(objects[0].int_value == 0);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - get_values/set_values - stride", "[property]")
+{
+    std::vector<batch_access_test> objects = {batch_access_test(1), batch_access_test(2), batch_access_test(3)};
+    type t = type::get<batch_access_test>();
+
+    SECTION("member object")
+    {
+        property prop = t.get_property("int_value");
+        int values[3] = {};
+        CHECK(prop.get_values(objects.data(), sizeof(batch_access_test), objects.size(), values) == true);
+        CHECK(values[0] == 1);
+        CHECK(values[2] == 3);
+
+        const int new_values[3] = {10, 20, 30};
+        CHECK(prop.set_values(objects.data(), sizeof(batch_access_test), objects.size(), new_values) == true);
+        CHECK(objects[0].int_value == 10);
+        CHECK(objects[2].int_value == 30);
+
+        // every second object
+        CHECK(prop.get_values(objects.data(), 2 * sizeof(batch_access_test), 2, values) == true);
+        CHECK(values[0] == 10);
+        CHECK(values[1] == 30);
+    }
+
+    SECTION("member function")
+    {
+        property prop = t.get_property("func_value");
+        const int new_values[3] = {4, 5, 6};
+        CHECK(prop.set_values(objects.data(), sizeof(batch_access_test), objects.size(), new_values) == true);
+        int values[3] = {};
+        CHECK(prop.get_values(objects.data(), sizeof(batch_access_test), objects.size(), values) == true);
+        CHECK(values[1] == 5);
+    }
+
+    SECTION("std::string")
+    {
+        property prop = t.get_property("text_value");
+        std::string values[3];
+        CHECK(prop.get_values(objects.data(), sizeof(batch_access_test), objects.size(), values) == true);
+        CHECK(values[1] == "2");
+    }
+
+    SECTION("NEGATIVE")
+    {
+        int values[3] = {};
+        CHECK(t.get_property("int_value_ro").get_values(objects.data(), sizeof(batch_access_test), objects.size(), values) == true);
+        CHECK(t.get_property("int_value_ro").set_values(objects.data(), sizeof(batch_access_test), objects.size(), values) == false);
+
+        double double_values[3] = {};
+        CHECK(t.get_property("int_value").get_values(objects.data(), sizeof(batch_access_test), objects.size(), double_values) == false);
+
+        property invalid_prop = type::get_by_name("").get_property("");
+        CHECK(invalid_prop.get_values(objects.data(), sizeof(batch_access_test), objects.size(), values) == false);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
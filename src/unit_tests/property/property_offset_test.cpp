@@ -0,0 +1,203 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/registration>
+#include <catch/catch.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+using namespace rttr;
+using namespace std;
+
+struct offset_test_base
+{
+    virtual ~offset_test_base() {}
+    int base_value = 1;
+
+    RTTR_ENABLE()
+};
+
+struct offset_test : offset_test_base
+{
+    int get_func_value() const { return int_value; }
+    void set_func_value(int value) { int_value = value; }
+
+    int         int_value = 23;
+    double      double_value = 42.0;
+    float       float_array[3] = {1.0f, 2.0f, 3.0f};
+    std::string text_value = "Hello";
+    static int  static_value;
+
+    RTTR_ENABLE(offset_test_base)
+};
+
+int offset_test::static_value = 0;
+
+struct offset_test_second_base
+{
+    virtual ~offset_test_second_base() {}
+    double second_value = 2.0;
+
+    RTTR_ENABLE()
+};
+
+// the second base class is not located at the start address of the object
+struct offset_test_multi : offset_test_base, offset_test_second_base
+{
+    int multi_value = 3;
+
+    RTTR_ENABLE(offset_test_base, offset_test_second_base)
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<offset_test_base>("offset_test_base")
+        .property("base_value", &offset_test_base::base_value)
+        ;
+
+    registration::class_<offset_test>("offset_test")
+        .property("int_value", &offset_test::int_value)
+        .property_readonly("double_value", &offset_test::double_value)
+        .property("float_array", &offset_test::float_array)
+        .property("text_value", &offset_test::text_value)
+        .property("int_value_ptr", &offset_test::int_value)
+        (
+            policy::prop::bind_as_ptr
+        )
+        .property("base_value_derived", &offset_test_base::base_value)
+        .property("func_value", &offset_test::get_func_value, &offset_test::set_func_value)
+        .property("static_value", &offset_test::static_value)
+        ;
+
+    registration::class_<offset_test_second_base>("offset_test_second_base")
+        .property("second_value", &offset_test_second_base::second_value)
+        ;
+
+    registration::class_<offset_test_multi>("offset_test_multi")
+        .property("multi_value", &offset_test_multi::multi_value)
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - get_offset", "[property]")
+{
+    type t = type::get<offset_test>();
+    offset_test obj;
+    const char* base = reinterpret_cast<const char*>(&obj);
+
+    property prop = t.get_property("int_value");
+    REQUIRE(prop.has_offset() == true);
+    CHECK(base + prop.get_offset() == reinterpret_cast<const char*>(&obj.int_value));
+
+    prop = t.get_property("double_value");
+    REQUIRE(prop.has_offset() == true);
+    CHECK(base + prop.get_offset() == reinterpret_cast<const char*>(&obj.double_value));
+
+    prop = t.get_property("float_array");
+    REQUIRE(prop.has_offset() == true);
+    CHECK(base + prop.get_offset() == reinterpret_cast<const char*>(&obj.float_array));
+
+    prop = t.get_property("text_value");
+    REQUIRE(prop.has_offset() == true);
+    CHECK(base + prop.get_offset() == reinterpret_cast<const char*>(&obj.text_value));
+
+    prop = type::get<offset_test_base>().get_property("base_value");
+    REQUIRE(prop.has_offset() == true);
+    const offset_test_base& base_obj = obj;
+    CHECK(reinterpret_cast<const char*>(&base_obj) + prop.get_offset() == reinterpret_cast<const char*>(&obj.base_value));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - is_trivially_copyable", "[property]")
+{
+    type t = type::get<offset_test>();
+
+    CHECK(t.get_property("int_value").is_trivially_copyable() == true);
+    CHECK(t.get_property("double_value").is_trivially_copyable() == true);
+    CHECK(t.get_property("float_array").is_trivially_copyable() == true);
+    CHECK(t.get_property("text_value").is_trivially_copyable() == false);
+
+    // gather a value with a raw memory copy
+    offset_test obj;
+    obj.double_value = 12.5;
+    property prop = t.get_property("double_value");
+    double value = 0.0;
+    REQUIRE(prop.get_type().get_sizeof() == sizeof(double));
+    std::memcpy(&value, reinterpret_cast<const char*>(&obj) + prop.get_offset(), prop.get_type().get_sizeof());
+    CHECK(value == 12.5);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - get_offset - NEGATIVE", "[property]")
+{
+    type t = type::get<offset_test>();
+
+    for (const auto& name : {"int_value_ptr", "base_value_derived", "func_value", "static_value"})
+    {
+        property prop = t.get_property(name);
+        REQUIRE(prop.is_valid() == true);
+        CHECK(prop.has_offset() == false);
+        CHECK(prop.get_offset() == 0);
+        CHECK(prop.is_trivially_copyable() == false);
+    }
+
+    property invalid_prop = type::get_by_name("").get_property("");
+    CHECK(invalid_prop.has_offset() == false);
+    CHECK(invalid_prop.get_offset() == 0);
+    CHECK(invalid_prop.is_trivially_copyable() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - get_offset - inherited property", "[property]")
+{
+    offset_test_multi obj;
+    const char* derived_base = reinterpret_cast<const char*>(&obj);
+    type t = type::get<offset_test_multi>();
+
+    property prop = t.get_property("multi_value");
+    REQUIRE(prop.has_offset() == true);
+    CHECK(derived_base + prop.get_offset() == reinterpret_cast<const char*>(&obj.multi_value));
+
+    // the offset of an inherited property is relative to the subobject of its declaring type
+    prop = t.get_property("second_value");
+    REQUIRE(prop.is_valid() == true);
+    REQUIRE(prop.has_offset() == true);
+    CHECK(prop.get_declaring_type() == type::get<offset_test_second_base>());
+    const offset_test_second_base& second_base = obj;
+    REQUIRE(reinterpret_cast<const char*>(&second_base) != derived_base);
+    CHECK(reinterpret_cast<const char*>(&second_base) + prop.get_offset() == reinterpret_cast<const char*>(&obj.second_value));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,229 @@
+/************************************************************************************
+*                                                                                   *
+*   Copyright (c) 2014 - 2018 Axel Menzel <info@rttr.org>                           *
+*                                                                                   *
+*   This file is part of RTTR (Run Time Type Reflection)                            *
+*   License: MIT License                                                            *
+*                                                                                   *
+*   Permission is hereby granted, free of charge, to any person obtaining           *
+*   a copy of this software and associated documentation files (the "Software"),    *
+*   to deal in the Software without restriction, including without limitation       *
+*   the rights to use, copy, modify, merge, publish, distribute, sublicense,        *
+*   and/or sell copies of the Software, and to permit persons to whom the           *
+*   Software is furnished to do so, subject to the following conditions:            *
+*                                                                                   *
+*   The above copyright notice and this permission notice shall be included in      *
+*   all copies or substantial portions of the Software.                             *
+*                                                                                   *
+*   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      *
+*   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        *
+*   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     *
+*   AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          *
+*   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   *
+*   OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   *
+*   SOFTWARE.                                                                       *
+*                                                                                   *
+*************************************************************************************/
+
+#include <rttr/registration>
+#include <catch/catch.hpp>
+
+#include <string>
+
+using namespace rttr;
+using namespace std;
+
+struct typed_accessor_base
+{
+    virtual ~typed_accessor_base() {}
+    int base_value = 12;
+
+    RTTR_ENABLE()
+};
+
+struct typed_accessor_test : typed_accessor_base
+{
+    int get_func_value() { return m_func_value; }
+    void set_func_value(int value) { m_func_value = value; }
+    const std::string& get_text() const { return m_text; }
+    void set_text(const std::string& text) { m_text = text; }
+
+    int         int_value = 23;
+    std::string text_value = "Hello";
+    static int  static_value;
+    int         int_array[3] = {1, 2, 3};
+
+    int         m_func_value = 0;
+    std::string m_text;
+
+    RTTR_ENABLE(typed_accessor_base)
+};
+
+int typed_accessor_test::static_value = 0;
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+RTTR_REGISTRATION
+{
+    registration::class_<typed_accessor_base>("typed_accessor_base")
+        .property("base_value", &typed_accessor_base::base_value)
+        ;
+
+    registration::class_<typed_accessor_test>("typed_accessor_test")
+        .property("int_value", &typed_accessor_test::int_value)
+        .property("text_value", &typed_accessor_test::text_value)
+        .property_readonly("int_value_ro", &typed_accessor_test::int_value)
+        .property("int_value_ptr", &typed_accessor_test::int_value)
+        (
+            policy::prop::bind_as_ptr
+        )
+        .property("func_value", &typed_accessor_test::get_func_value, &typed_accessor_test::set_func_value)
+        .property_readonly("func_value_ro", &typed_accessor_test::get_func_value)
+        .property("text", &typed_accessor_test::get_text, &typed_accessor_test::set_text)
+        .property("static_value", &typed_accessor_test::static_value)
+        .property("int_array", &typed_accessor_test::int_array)
+        .property("int_array_ptr", &typed_accessor_test::int_array)
+        (
+            policy::prop::bind_as_ptr
+        )
+        ;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - get_accessor - member object", "[property]")
+{
+    type t = type::get<typed_accessor_test>();
+    typed_accessor_test obj;
+
+    auto int_acc = t.get_property("int_value").get_accessor<typed_accessor_test, int>();
+    REQUIRE(int_acc.is_valid() == true);
+    CHECK(int_acc.is_readonly() == false);
+    CHECK(int_acc.get(obj) == 23);
+    CHECK(int_acc.set(obj, 42) == true);
+    CHECK(obj.int_value == 42);
+
+    auto text_acc = t.get_property("text_value").get_accessor<typed_accessor_test, std::string>();
+    REQUIRE(static_cast<bool>(text_acc) == true);
+    CHECK(text_acc.get(obj) == "Hello");
+    CHECK(text_acc.set(obj, "World") == true);
+    CHECK(obj.text_value == "World");
+
+    // a const reference refers directly to the member, no copy is made
+    auto text_ref_acc = t.get_property("text_value").get_accessor<typed_accessor_test, const std::string&>();
+    REQUIRE(text_ref_acc.is_valid() == true);
+    const std::string& text_ref = text_ref_acc.get(obj);
+    CHECK(&text_ref == &obj.text_value);
+    CHECK(text_ref_acc.set(obj, "Hello World") == true);
+    CHECK(text_ref == "Hello World");
+
+    // policies are not taken into account
+    auto ptr_acc = t.get_property("int_value_ptr").get_accessor<typed_accessor_test, int>();
+    REQUIRE(ptr_acc.is_valid() == true);
+    CHECK(ptr_acc.get(obj) == 42);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - get_accessor - read only", "[property]")
+{
+    type t = type::get<typed_accessor_test>();
+    typed_accessor_test obj;
+
+    auto ro_acc = t.get_property("int_value_ro").get_accessor<typed_accessor_test, int>();
+    REQUIRE(ro_acc.is_valid() == true);
+    CHECK(ro_acc.is_readonly() == true);
+    CHECK(ro_acc.set(obj, 42) == false);
+    CHECK(ro_acc.get(obj) == 23);
+
+    auto ro_ref_acc = t.get_property("int_value_ro").get_accessor<typed_accessor_test, const int&>();
+    REQUIRE(ro_ref_acc.is_valid() == true);
+    CHECK(ro_ref_acc.is_readonly() == true);
+    CHECK(&ro_ref_acc.get(obj) == &obj.int_value);
+
+    auto func_ro_acc = t.get_property("func_value_ro").get_accessor<typed_accessor_test, int>();
+    REQUIRE(func_ro_acc.is_valid() == true);
+    CHECK(func_ro_acc.is_readonly() == true);
+    CHECK(func_ro_acc.set(obj, 42) == false);
+    CHECK(func_ro_acc.get(obj) == 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - get_accessor - member function", "[property]")
+{
+    type t = type::get<typed_accessor_test>();
+    typed_accessor_test obj;
+
+    auto func_acc = t.get_property("func_value").get_accessor<typed_accessor_test, int>();
+    REQUIRE(func_acc.is_valid() == true);
+    CHECK(func_acc.set(obj, 42) == true);
+    CHECK(obj.m_func_value == 42);
+    CHECK(func_acc.get(obj) == 42);
+
+    auto text_acc = t.get_property("text").get_accessor<typed_accessor_test, std::string>();
+    REQUIRE(text_acc.is_valid() == true);
+    CHECK(text_acc.set(obj, "Hello World") == true);
+    CHECK(text_acc.get(obj) == "Hello World");
+
+    // the getter returns a reference, so it can be read without a copy
+    auto text_ref_acc = t.get_property("text").get_accessor<typed_accessor_test, const std::string&>();
+    REQUIRE(text_ref_acc.is_valid() == true);
+    CHECK(&text_ref_acc.get(obj) == &obj.m_text);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - get_accessor - base class property", "[property]")
+{
+    typed_accessor_test obj;
+    property prop = type::get<typed_accessor_base>().get_property("base_value");
+
+    auto base_acc = prop.get_accessor<typed_accessor_base, int>();
+    REQUIRE(base_acc.is_valid() == true);
+    CHECK(base_acc.get(obj) == 12);
+    base_acc.set(obj, 42);
+    CHECK(obj.base_value == 42);
+
+    // the derived class cannot be used, because it is not the declaring type of the property
+    auto derived_acc = prop.get_accessor<typed_accessor_test, int>();
+    CHECK(derived_acc.is_valid() == false);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE("property - get_accessor - NEGATIVE", "[property]")
+{
+    type t = type::get<typed_accessor_test>();
+
+    // wrong value type
+    auto double_acc = t.get_property("int_value").get_accessor<typed_accessor_test, double>();
+    CHECK(double_acc.is_valid() == false);
+    // the getter returns by value, so no reference can be provided
+    auto ref_acc = t.get_property("func_value").get_accessor<typed_accessor_test, const int&>();
+    CHECK(ref_acc.is_valid() == false);
+    // wrong class type
+    auto base_acc = t.get_property("int_value").get_accessor<typed_accessor_base, int>();
+    CHECK(base_acc.is_valid() == false);
+    // static properties are not supported
+    auto static_acc = t.get_property("static_value").get_accessor<typed_accessor_test, int>();
+    CHECK(static_acc.is_valid() == false);
+    // arrays cannot be returned by value
+    auto array_acc = t.get_property("int_array").get_accessor<typed_accessor_test, int*>();
+    CHECK(array_acc.is_valid() == false);
+    auto array_ptr_acc = t.get_property("int_array_ptr").get_accessor<typed_accessor_test, int*>();
+    CHECK(array_ptr_acc.is_valid() == false);
+
+    property invalid_prop = type::get_by_name("").get_property("");
+    auto invalid_acc = invalid_prop.get_accessor<typed_accessor_test, int>();
+    CHECK(invalid_acc.is_valid() == false);
+
+    typed_accessor<typed_accessor_test, int> default_acc;
+    auto valid_acc = t.get_property("int_value").get_accessor<typed_accessor_test, int>();
+    CHECK(default_acc.is_valid() == false);
+    CHECK(default_acc.is_readonly() == true);
+    CHECK(default_acc == invalid_acc);
+    CHECK(default_acc != valid_acc);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
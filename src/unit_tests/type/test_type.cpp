@@ -345,6 +345,19 @@ TEST_CASE("Test rttr::type - Check get_sizeof", "[type]")
 
 /////////////////////////////////////////////////////////////////////////////////////////
 
+TEST_CASE("Test rttr::type - Check get_alignof", "[type]")
+{
+    CHECK(type::get<char>().get_alignof()       == alignof(char));
+    CHECK(type::get<int>().get_alignof()        == alignof(int));
+    CHECK(type::get<double>().get_alignof()     == alignof(double));
+    CHECK(type::get<int*>().get_alignof()       == alignof(int*));
+    CHECK(type::get<void>().get_alignof()       == 0);
+    CHECK(type::get<void(int)>().get_alignof()  == 0);
+    CHECK(type::get_by_name("").get_alignof()   == 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+
 TEST_CASE("Test rttr::type - Check is_arithmetic", "[type]")
 {
     CHECK(type::get<int>().is_arithmetic()               == true);
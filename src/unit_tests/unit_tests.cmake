@@ -40,6 +40,11 @@ set(SOURCE_FILES main.cpp
                  misc/string_view_test.cpp
                  misc/enum_flags_test.cpp
                  misc/library_test.cpp
+                 misc/object_pool_test.cpp
+                 misc/access_plan_test.cpp
+                 misc/binary_serialization_test.cpp
+                 misc/binary_view_test.cpp
+                 misc/json_serialization_test.cpp
                  property/property_access_level_test.cpp
                  property/property_misc_test.cpp
                  property/property_class_inheritance.cpp
@@ -49,6 +54,9 @@ set(SOURCE_FILES main.cpp
                  property/property_order_test.cpp
                  property/property_global_function.cpp
                  property/property_global_object.cpp
+                 property/property_typed_accessor_test.cpp
+                 property/property_offset_test.cpp
+                 property/property_batch_access_test.cpp
                  type/test_type.cpp
                  type/test_type_names.cpp
                  type/type_prop_meth_invoke.cpp
@@ -59,6 +67,7 @@ set(SOURCE_FILES main.cpp
                  constructor/constructor_param_info_test.cpp
                  constructor/constructor_retrieve_test.cpp
                  constructor/constructor_invoke_test.cpp
+                 constructor/constructor_invoke_at_test.cpp
                  constructor/constructor_misc_test.cpp
                  constructor/constructor_query_test.cpp
                  enumeration/enumeration_conversion.cpp
@@ -70,9 +79,11 @@ set(SOURCE_FILES main.cpp
                  method/method_default_arg_test.cpp
                  method/method_misc_test.cpp
                  method/method_invoke_test.cpp
+                 method/method_invoke_allocation_test.cpp
                  method/method_order_test.cpp
                  method/method_param_info_test.cpp
                  method/method_query_test.cpp
+                 method/method_typed_invoker_test.cpp
                  variant/variant_assign_test.cpp
                  variant/variant_conv_test.cpp
                  variant/variant_ctor_test.cpp